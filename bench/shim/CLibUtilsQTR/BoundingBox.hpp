@@ -0,0 +1,46 @@
+#pragma once
+
+namespace DirectX {
+    struct XMFLOAT3 {
+        float x = 0.f;
+        float y = 0.f;
+        float z = 0.f;
+    };
+
+    struct XMFLOAT4 {
+        float x = 0.f;
+        float y = 0.f;
+        float z = 0.f;
+        float w = 1.f;
+    };
+
+    // Axis-aligned stand-in: refs in the benchmarks have no 3D, so orientation never matters.
+    struct BoundingOrientedBox {
+        XMFLOAT3 Center;
+        XMFLOAT3 Extents{1.f, 1.f, 1.f};
+        XMFLOAT4 Orientation;
+
+        [[nodiscard]] bool Intersects(const BoundingOrientedBox& o) const {
+            return std::abs(Center.x - o.Center.x) <= Extents.x + o.Extents.x &&
+                   std::abs(Center.y - o.Center.y) <= Extents.y + o.Extents.y &&
+                   std::abs(Center.z - o.Center.z) <= Extents.z + o.Extents.z;
+        }
+
+        void GetCorners(XMFLOAT3* a_corners) const {
+            for (int i = 0; i < 8; ++i) {
+                a_corners[i] = {Center.x + (i & 1 ? Extents.x : -Extents.x),
+                                Center.y + (i & 2 ? Extents.y : -Extents.y),
+                                Center.z + (i & 4 ? Extents.z : -Extents.z)};
+            }
+        }
+    };
+}
+
+namespace BoundingBox {
+    inline void GetOBB(const RE::TESObjectREFR* a_refr, DirectX::BoundingOrientedBox& a_obb) {
+        const auto pos = a_refr->GetPosition();
+        a_obb.Center = {pos.x, pos.y, pos.z};
+    }
+
+    inline void GetOBB(const RE::bhkRigidBody*, DirectX::BoundingOrientedBox&) {}
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include "CLibUtilsQTR/BoundingBox.hpp"
+
+namespace DebugAPI_IMPL::DrawDebug {
+    inline void DrawOBB(const DirectX::BoundingOrientedBox&, float = 0.f) {}
+    inline void draw_line(const RE::NiPoint3&, const RE::NiPoint3&, float = 0.f,
+                          const RE::NiColorA& = {}) {}
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "ClibUtil/editorID.hpp"
+
+namespace FormReader {
+    inline RE::TESForm* GetFormByID(const FormID a_id, const std::string& a_editorID = "") {
+        if (a_id) {
+            if (const auto form = RE::TESForm::LookupByID(a_id)) return form;
+        }
+        return a_editorID.empty() ? nullptr : RE::TESForm::LookupByEditorID(a_editorID);
+    }
+
+    template <class T>
+    T* GetFormByID(const FormID a_id, const std::string& a_editorID = "") {
+        const auto form = GetFormByID(a_id, a_editorID);
+        return form ? form->As<T>() : nullptr;
+    }
+
+    inline std::string GetEditorID(const FormID a_id) {
+        const auto form = RE::TESForm::LookupByID(a_id);
+        return form ? std::string(form->GetFormEditorID()) : std::string{};
+    }
+}
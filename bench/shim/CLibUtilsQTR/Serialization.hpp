@@ -0,0 +1,33 @@
+#pragma once
+
+namespace Serialization {
+    // Same shape as the library's keyed save record; the benchmarks never hit the SKSE co-save.
+    template <class Key, class Value>
+    class BaseData {
+    public:
+        using Locker = std::lock_guard<std::recursive_mutex>;
+
+        virtual ~BaseData() = default;
+
+        virtual const char* GetType() = 0;
+
+        [[nodiscard]] virtual bool Save(SKSE::SerializationInterface* a_intfc) = 0;
+        [[nodiscard]] virtual bool Save(SKSE::SerializationInterface* a_intfc, std::uint32_t a_type,
+                                        std::uint32_t a_version) = 0;
+        [[nodiscard]] virtual bool Load(SKSE::SerializationInterface* a_intfc) = 0;
+
+        void SetData(const Key& a_key, const Value& a_value) {
+            Locker locker(m_Lock);
+            m_Data[a_key] = a_value;
+        }
+
+        void Clear() {
+            Locker locker(m_Lock);
+            m_Data.clear();
+        }
+
+    protected:
+        std::map<Key, Value> m_Data;
+        mutable std::recursive_mutex m_Lock;
+    };
+}
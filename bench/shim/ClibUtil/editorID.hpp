@@ -0,0 +1,7 @@
+#pragma once
+
+namespace clib_util::editorID {
+    inline std::string get_editorID(const RE::TESForm* a_form) {
+        return a_form ? std::string(a_form->GetFormEditorID()) : std::string{};
+    }
+}
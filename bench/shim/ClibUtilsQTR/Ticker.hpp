@@ -0,0 +1,18 @@
+#pragma once
+
+// Never started by the benchmarks; kept so classes deriving from the library ticker stay constructible.
+class Ticker {
+public:
+    Ticker(std::function<void()> a_onTick, const std::chrono::milliseconds a_interval)
+        : m_OnTick(std::move(a_onTick)), m_Interval(a_interval) {}
+
+    void Start() { m_Running = true; }
+    void Stop() { m_Running = false; }
+    void UpdateInterval(const std::chrono::milliseconds a_interval) { m_Interval = a_interval; }
+    [[nodiscard]] bool isRunning() const { return m_Running; }
+
+protected:
+    std::function<void()> m_OnTick;
+    std::chrono::milliseconds m_Interval;
+    std::atomic<bool> m_Running = false;
+};
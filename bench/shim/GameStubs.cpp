@@ -0,0 +1,60 @@
+// Out-of-line symbols the stage-evolution sources reference but whose translation units (Manager, Settings,
+// Lorebox, Serialization) need the running game. Each stand-in does the least that keeps a Source consistent:
+// no presets are loaded, so every benchmark form is an item of the type its form type suggests and has no add-ons.
+// The Manager is never constructed (M stays null); its stand-ins below do not touch the instance.
+#include "Data.h"
+#include "Manager.h"
+#include "Settings.h"
+
+std::string_view Settings::GetQFormType(const RE::TESForm* form) {
+    if (!form) return {};
+    switch (form->GetFormType()) {
+        case RE::FormType::AlchemyItem:
+            return "FOOD";
+        case RE::FormType::Ingredient:
+            return "INGR";
+        case RE::FormType::Misc:
+            return "MISC";
+        case RE::FormType::Book:
+            return "BOOK";
+        case RE::FormType::Armor:
+            return "ARMO";
+        case RE::FormType::Weapon:
+            return "WEAP";
+        default:
+            return {};
+    }
+}
+
+std::string Settings::GetQFormType(const FormID formid) {
+    return std::string(GetQFormType(RE::TESForm::LookupByID(formid)));
+}
+
+bool Settings::IsItem(const FormID formid, const std::string& type, bool) {
+    const auto qform_type = GetQFormType(formid);
+    return !qform_type.empty() && (type.empty() || type == qform_type);
+}
+
+AddOnSettings* Settings::GetAddOnSettings(const RE::TESForm*) {
+    return nullptr;
+}
+
+bool Lorebox::AddKeyword(RE::BGSKeywordForm*, FormID) {
+    return false;
+}
+
+void Manager::IndexStage(FormID, FormID) {}
+
+void Manager::InstanceCountUpdate(int32_t) {}
+
+bool DFSaveLoadData::Save(SKSE::SerializationInterface*) {
+    return false;
+}
+
+bool DFSaveLoadData::Save(SKSE::SerializationInterface*, std::uint32_t, std::uint32_t) {
+    return false;
+}
+
+bool DFSaveLoadData::Load(SKSE::SerializationInterface*) {
+    return false;
+}
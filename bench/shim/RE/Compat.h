@@ -0,0 +1,33 @@
+#pragma once
+// Fills the C++23 library gaps of older standard libraries (the plugin itself is built with MSVC's) so the shared
+// sources compile unchanged on the benchmark toolchain.
+#include <algorithm>
+#include <ranges>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#if !defined(__cpp_lib_format)
+#include <fmt/format.h>
+namespace std {
+    using fmt::format;
+    using fmt::format_string;
+    using fmt::format_to;
+    using fmt::vformat;
+    using fmt::make_format_args;
+}
+#endif
+
+#if !defined(__cpp_lib_ranges_contains)
+namespace std::ranges {
+    struct contains_fn_ {
+        template <std::ranges::input_range R, class T, class Proj = std::identity>
+        constexpr bool operator()(R&& a_range, const T& a_value, Proj a_proj = {}) const {
+            const auto end = std::ranges::end(a_range);
+            return std::ranges::find(a_range, a_value, std::ref(a_proj)) != end;
+        }
+    };
+    inline constexpr contains_fn_ contains{};
+}
+#endif
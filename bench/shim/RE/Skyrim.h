@@ -0,0 +1,913 @@
+#pragma once
+// Headless stand-in for CommonLibSSE: just enough of RE:: for the stage-evolution core to compile and run outside
+// the game. Forms live in a process-wide table (RE::TESForm::Register / LookupByID), game time is whatever the
+// benchmark sets on RE::Calendar. Anything the benchmarks never reach is declared but left undefined or inert.
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <random>
+#include <ranges>
+#include <set>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <xmmintrin.h>
+
+#include <fmt/format.h>
+#include <fmt/xchar.h>
+
+#include "Compat.h"
+
+#ifndef MB_OK
+#define MB_OK 0x0u
+#define MB_ICONERROR 0x10u
+inline int MessageBoxA(void*, const char*, const char*, unsigned) { return 0; }
+#endif
+
+#ifndef _WIN32
+#define __declspec(x)
+#endif
+
+namespace REL {
+    struct Version {
+        std::uint16_t major = 0;
+        std::uint16_t minor = 0;
+        std::uint16_t patch = 0;
+        std::uint16_t build = 0;
+
+        [[nodiscard]] std::string string() const { return fmt::format("{}.{}.{}.{}", major, minor, patch, build); }
+    };
+}
+
+template <>
+struct fmt::formatter<REL::Version> : fmt::formatter<std::string> {
+    auto format(const REL::Version& a_version, fmt::format_context& a_ctx) const {
+        return fmt::formatter<std::string>::format(a_version.string(), a_ctx);
+    }
+};
+
+namespace RE {
+    using FormID = std::uint32_t;
+    using RefHandle = std::uint32_t;
+
+    enum class FormType : std::uint8_t {
+        None = 0,
+        Keyword = 4,
+        MagicEffect = 18,
+        Armor = 26,
+        Book = 27,
+        Container = 28,
+        Ingredient = 30,
+        Light = 31,
+        Misc = 32,
+        Weapon = 41,
+        Ammo = 42,
+        NPC = 43,
+        AlchemyItem = 46,
+        Scroll = 23,
+        SoulGem = 52,
+        Cell = 60,
+        Reference = 61,
+        ActorCharacter = 62,
+        WorldSpace = 71
+    };
+
+    struct NiPoint3 {
+        float x = 0.f;
+        float y = 0.f;
+        float z = 0.f;
+
+        NiPoint3() = default;
+        NiPoint3(const float a_x, const float a_y, const float a_z) : x(a_x), y(a_y), z(a_z) {}
+
+        NiPoint3 operator+(const NiPoint3& o) const { return {x + o.x, y + o.y, z + o.z}; }
+        NiPoint3 operator-(const NiPoint3& o) const { return {x - o.x, y - o.y, z - o.z}; }
+        NiPoint3 operator*(const float s) const { return {x * s, y * s, z * s}; }
+        NiPoint3& operator+=(const NiPoint3& o) { x += o.x; y += o.y; z += o.z; return *this; }
+        NiPoint3& operator-=(const NiPoint3& o) { x -= o.x; y -= o.y; z -= o.z; return *this; }
+        NiPoint3& operator*=(const float s) { x *= s; y *= s; z *= s; return *this; }
+        bool operator==(const NiPoint3&) const = default;
+
+        [[nodiscard]] float Dot(const NiPoint3& o) const { return x * o.x + y * o.y + z * o.z; }
+        [[nodiscard]] float SqrLength() const { return Dot(*this); }
+        [[nodiscard]] float Length() const { return std::sqrt(SqrLength()); }
+        [[nodiscard]] float GetSquaredDistance(const NiPoint3& o) const { return (*this - o).SqrLength(); }
+        [[nodiscard]] float GetDistance(const NiPoint3& o) const { return (*this - o).Length(); }
+    };
+
+    struct NiColorA {
+        float red = 0.f;
+        float green = 0.f;
+        float blue = 0.f;
+        float alpha = 0.f;
+    };
+
+    struct NiMatrix3 {
+        float entry[3][3]{{1.f, 0.f, 0.f}, {0.f, 1.f, 0.f}, {0.f, 0.f, 1.f}};
+
+        NiPoint3 operator*(const NiPoint3& p) const {
+            return {entry[0][0] * p.x + entry[0][1] * p.y + entry[0][2] * p.z,
+                    entry[1][0] * p.x + entry[1][1] * p.y + entry[1][2] * p.z,
+                    entry[2][0] * p.x + entry[2][1] * p.y + entry[2][2] * p.z};
+        }
+
+        [[nodiscard]] NiMatrix3 Transpose() const {
+            NiMatrix3 t;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) t.entry[i][j] = entry[j][i];
+            }
+            return t;
+        }
+    };
+
+    struct NiTransform {
+        NiMatrix3 rotate;
+        NiPoint3 translate;
+        float scale = 1.f;
+    };
+
+    class bhkRigidBody;
+
+    class bhkNiCollisionObject {
+    public:
+        [[nodiscard]] bhkRigidBody* GetRigidBody() const { return nullptr; }
+    };
+
+    class NiAVObject {
+    public:
+        [[nodiscard]] bhkNiCollisionObject* GetCollisionObject() const { return nullptr; }
+        void TintScenegraph(const NiColorA&) {}
+        NiTransform world;
+    };
+
+    template <class T>
+    class NiPointer {
+    public:
+        NiPointer() = default;
+        NiPointer(T* a_ptr) : ptr_(a_ptr) {}
+        T* get() const { return ptr_; }
+        T* operator->() const { return ptr_; }
+        T& operator*() const { return *ptr_; }
+        explicit operator bool() const { return ptr_ != nullptr; }
+        void reset() { ptr_ = nullptr; }
+
+    private:
+        T* ptr_ = nullptr;
+    };
+
+    template <class T>
+    class BSTArray : public std::vector<T> {
+    public:
+        using std::vector<T>::vector;
+    };
+
+    class BSFixedString {
+    public:
+        BSFixedString() = default;
+        BSFixedString(const char* a_str) : str_(a_str ? a_str : "") {}
+        BSFixedString(const std::string& a_str) : str_(a_str) {}
+        BSFixedString(std::string_view a_str) : str_(a_str) {}
+        [[nodiscard]] const char* c_str() const { return str_.c_str(); }
+        [[nodiscard]] const char* data() const { return str_.c_str(); }
+        [[nodiscard]] bool empty() const { return str_.empty(); }
+        [[nodiscard]] std::size_t size() const { return str_.size(); }
+        operator std::string_view() const { return str_; }
+        bool operator==(const BSFixedString&) const = default;
+
+    private:
+        std::string str_;
+    };
+
+    class TESForm;
+    class TESBoundObject;
+    class TESObjectREFR;
+    class TESObjectCELL;
+    class TESWorldSpace;
+
+    class TESForm {
+    public:
+        TESForm() = default;
+        TESForm(const FormID a_id, const FormType a_type) : formID(a_id), formType(a_type) {}
+        virtual ~TESForm() = default;
+
+        [[nodiscard]] FormID GetFormID() const { return formID; }
+        [[nodiscard]] FormType GetFormType() const { return formType; }
+        [[nodiscard]] bool Is(const FormType a_type) const { return formType == a_type; }
+        template <class... Ts>
+        [[nodiscard]] bool Is(const FormType a_first, const Ts... a_rest) const {
+            return Is(a_first) || (Is(a_rest) || ...);
+        }
+        [[nodiscard]] bool IsDynamicForm() const { return formID >= 0xFF000000; }
+        [[nodiscard]] bool IsDeleted() const { return false; }
+        [[nodiscard]] bool IsIngestible() const { return formType == FormType::AlchemyItem; }
+        [[nodiscard]] bool IsWeapon() const { return formType == FormType::Weapon; }
+        [[nodiscard]] bool IsArmor() const { return formType == FormType::Armor; }
+        [[nodiscard]] virtual const char* GetName() const { return name.c_str(); }
+        [[nodiscard]] std::string_view GetFormEditorID() const { return editorID; }
+        void Copy(TESForm*) {}
+        void SetFormID(const FormID a_id, bool) { formID = a_id; }
+        bool SetFormEditorID(const char* a_str) {
+            editorID = a_str ? a_str : "";
+            return true;
+        }
+
+        template <class T>
+        T* As() {
+            return dynamic_cast<T*>(this);
+        }
+
+        template <class T>
+        const T* As() const {
+            return dynamic_cast<const T*>(this);
+        }
+
+        // Benchmark side: forms are owned by whoever creates them and must outlive their registration.
+        static void Register(TESForm* a_form) { Table_()[a_form->formID] = a_form; }
+        static void Unregister(const FormID a_id) { Table_().erase(a_id); }
+        static void ClearTable() { Table_().clear(); }
+
+        static TESForm* LookupByID(const FormID a_id) {
+            const auto& table = Table_();
+            const auto it = table.find(a_id);
+            return it != table.end() ? it->second : nullptr;
+        }
+
+        template <class T>
+        static T* LookupByID(const FormID a_id) {
+            const auto form = LookupByID(a_id);
+            return form ? form->As<T>() : nullptr;
+        }
+
+        static TESForm* LookupByEditorID(std::string_view a_editorID) {
+            for (const auto form : Table_() | std::views::values) {
+                if (form->editorID == a_editorID) return form;
+            }
+            return nullptr;
+        }
+
+        template <class T>
+        static T* LookupByEditorID(std::string_view a_editorID) {
+            const auto form = LookupByEditorID(a_editorID);
+            return form ? form->As<T>() : nullptr;
+        }
+
+        FormID formID = 0;
+        FormType formType = FormType::None;
+        std::string name;
+        std::string editorID;
+
+    private:
+        static std::unordered_map<FormID, TESForm*>& Table_() {
+            static std::unordered_map<FormID, TESForm*> table;
+            return table;
+        }
+    };
+
+    // Form components only need to exist and copy onto each other (DynamicFormTracker::ReviveDynamicForm).
+    class BaseFormComponent {
+    public:
+        virtual ~BaseFormComponent() = default;
+        void CopyComponent(BaseFormComponent*) {}
+    };
+
+    class TESFullName : public BaseFormComponent {
+    public:
+        BSFixedString fullName;
+    };
+
+    class TESDescription : public BaseFormComponent {};
+    class BGSPickupPutdownSounds : public BaseFormComponent {};
+    class TESModel : public BaseFormComponent {};
+    class TESModelTextureSwap : public TESModel {};
+    class BGSMessageIcon : public BaseFormComponent {};
+    class TESIcon : public BaseFormComponent {};
+    class BGSDestructibleObjectForm : public BaseFormComponent {};
+    class TESEnchantableForm : public BaseFormComponent {};
+    class BGSBlockBashData : public BaseFormComponent {};
+    class BGSEquipType : public BaseFormComponent {};
+    class TESAttackDamageForm : public BaseFormComponent {};
+    class TESBipedModelForm : public BaseFormComponent {};
+
+    class TESBoundObject : public TESForm {
+    public:
+        using TESForm::TESForm;
+    };
+
+    class BGSKeyword : public TESForm {
+    public:
+        static BGSKeyword* CreateKeyword(std::string_view) { return nullptr; }
+    };
+
+    class BGSKeywordForm : public BaseFormComponent {
+    public:
+        bool AddKeyword(BGSKeyword*) { return true; }
+        bool RemoveKeyword(BGSKeyword*) { return true; }
+        [[nodiscard]] bool HasKeyword(const BGSKeyword*) const { return false; }
+        [[nodiscard]] bool HasKeywordString(std::string_view) const { return false; }
+    };
+
+    class EffectSetting : public TESForm {};
+
+    class Effect {
+    public:
+        struct EffectItem {
+            float magnitude = 0.f;
+            std::uint32_t area = 0;
+            std::uint32_t duration = 0;
+        };
+
+        EffectItem effectItem;
+        EffectSetting* baseEffect = nullptr;
+        float cost = 0.f;
+    };
+
+    class TESValueForm : public BaseFormComponent {
+    public:
+        std::int32_t value = 0;
+    };
+
+    class TESWeightForm : public BaseFormComponent {
+    public:
+        float weight = 0.f;
+    };
+
+    class MagicItem;
+    class AlchemyItem;
+    class IngredientItem;
+
+    class MagicItem : public TESBoundObject, public TESFullName, public BGSKeywordForm {
+    public:
+        using TESBoundObject::TESBoundObject;
+        BSTArray<Effect*> effects;
+        [[nodiscard]] const char* GetName() const override { return fullName.c_str(); }
+        [[nodiscard]] std::int32_t GetGoldValue() const { return goldValue; }
+        [[nodiscard]] bool IsFood() const { return food; }
+        [[nodiscard]] bool IsPoison() const { return poison; }
+        [[nodiscard]] bool IsMedicine() const { return !food && !poison; }
+
+        std::int32_t goldValue = 0;
+        bool food = false;
+        bool poison = false;
+    };
+
+    class AlchemyItem : public MagicItem, public TESWeightForm {
+    public:
+        static constexpr auto FORMTYPE = FormType::AlchemyItem;
+        using MagicItem::MagicItem;
+        struct Data {
+            std::int32_t costOverride = 0;
+        } data;
+    };
+
+    class IngredientItem : public MagicItem, public TESValueForm, public TESWeightForm {
+    public:
+        static constexpr auto FORMTYPE = FormType::Ingredient;
+        using MagicItem::MagicItem;
+        struct Data {
+            std::int32_t costOverride = 0;
+        } gamedata;
+    };
+
+    class ScrollItem : public MagicItem, public TESValueForm, public TESWeightForm {
+    public:
+        using MagicItem::MagicItem;
+    };
+
+    class ItemForm_ : public TESBoundObject, public TESFullName, public BGSKeywordForm, public TESValueForm,
+                      public TESWeightForm {
+    public:
+        using TESBoundObject::TESBoundObject;
+        [[nodiscard]] const char* GetName() const override { return fullName.c_str(); }
+    };
+
+    class TESObjectMISC : public ItemForm_ {
+    public:
+        using ItemForm_::ItemForm_;
+    };
+
+    class SpellItem : public MagicItem {
+    public:
+        using MagicItem::MagicItem;
+    };
+
+    class TESObjectBOOK : public ItemForm_ {
+    public:
+        using ItemForm_::ItemForm_;
+        struct Data {
+            std::uint8_t flags = 0;
+            std::uint8_t type = 0;
+            union Teaches {
+                SpellItem* spell;
+                std::int32_t actorValueToAdvance;
+            } teaches{nullptr};
+        } data;
+        TESModel* inventoryModel = nullptr;
+        BSFixedString itemCardDescription;
+    };
+
+    class TESObjectARMO : public ItemForm_ {
+    public:
+        using ItemForm_::ItemForm_;
+    };
+
+    class TESObjectWEAP : public ItemForm_ {
+    public:
+        using ItemForm_::ItemForm_;
+        struct Data {
+            float speed = 1.f;
+            float reach = 1.f;
+        };
+        struct CriticalData {
+            float prcntMult = 0.f;
+        };
+        TESForm* firstPersonModelObject = nullptr;
+        Data weaponData;
+        CriticalData criticalData;
+        TESForm* attackSound = nullptr;
+        TESForm* attackSound2D = nullptr;
+        TESForm* attackFailSound = nullptr;
+        TESForm* idleSound = nullptr;
+        TESForm* equipSound = nullptr;
+        TESForm* unequipSound = nullptr;
+        std::uint32_t soundLevel = 0;
+        TESForm* impactDataSet = nullptr;
+        TESObjectWEAP* templateWeapon = nullptr;
+        BSFixedString embeddedNode;
+    };
+
+    class TESAmmo : public ItemForm_ {
+    public:
+        using ItemForm_::ItemForm_;
+        struct RuntimeData {
+            struct Data {
+                TESForm* projectile = nullptr;
+                std::uint32_t flags = 0;
+                float damage = 0.f;
+            } data;
+        };
+        RuntimeData& GetRuntimeData() { return runtimeData; }
+        [[nodiscard]] const RuntimeData& GetRuntimeData() const { return runtimeData; }
+        [[nodiscard]] float GetWeight() const { return weight; }
+        RuntimeData runtimeData;
+    };
+
+    class TESSoulGem : public ItemForm_ {
+    public:
+        using ItemForm_::ItemForm_;
+    };
+
+    class TESObjectLIGH : public ItemForm_ {
+    public:
+        using ItemForm_::ItemForm_;
+    };
+
+    class TESObjectREFR;
+
+    class TESFaction : public TESForm {
+    public:
+        struct VendorData {
+            TESObjectREFR* merchantContainer = nullptr;
+        } vendorData;
+    };
+
+    struct FACTION_RANK {
+        TESFaction* faction = nullptr;
+        std::int8_t rank = 0;
+    };
+
+    class TESNPC : public TESBoundObject, public TESFullName {
+    public:
+        using TESBoundObject::TESBoundObject;
+        std::vector<FACTION_RANK> factions;
+    };
+
+    class TESObjectCONT : public TESBoundObject, public TESFullName {
+    public:
+        using TESBoundObject::TESBoundObject;
+    };
+
+    class BGSArtObject : public TESBoundObject {};
+    class TESEffectShader : public TESForm {};
+    class BGSSoundDescriptorForm : public TESBoundObject {};
+
+    namespace BSContainer {
+        enum class ForEachResult { kContinue, kStop };
+    }
+
+    struct CellID {
+        std::int16_t y = 0;
+        std::int16_t x = 0;
+
+        bool operator==(const CellID&) const = default;
+    };
+
+    struct CellIDHash {
+        std::size_t operator()(const CellID& a_id) const noexcept {
+            return std::hash<std::uint32_t>{}(static_cast<std::uint16_t>(a_id.y) << 16 | static_cast<std::uint16_t>(a_id.x));
+        }
+    };
+
+    class TESObjectCELL;
+
+    class TESWorldSpace : public TESForm {
+    public:
+        using TESForm::TESForm;
+        [[nodiscard]] TESObjectCELL* GetSkyCell() const { return skyCell; }
+
+        std::unordered_map<CellID, TESObjectCELL*, CellIDHash> cellMap;
+        TESObjectCELL* skyCell = nullptr;
+    };
+
+    class TESObjectCELL : public TESForm {
+    public:
+        struct ExteriorData {
+            std::int32_t cellX = 0;
+            std::int32_t cellY = 0;
+        };
+
+        using TESForm::TESForm;
+        [[nodiscard]] bool IsInteriorCell() const { return interior; }
+        [[nodiscard]] bool IsAttached() const { return true; }
+        [[nodiscard]] const ExteriorData* GetCoordinates() const { return interior ? nullptr : &coordinates; }
+
+        template <class F>
+        void ForEachReference(F&& a_callback) const;
+
+        TESWorldSpace* worldSpace = nullptr;
+        bool interior = true;
+        ExteriorData coordinates;
+        std::vector<TESObjectREFR*> references;
+    };
+
+    struct hkVector4 {
+        __m128 quad{};
+    };
+
+    class bhkRigidBody {
+    public:
+        void GetPosition(hkVector4& a_out) const { a_out.quad = _mm_setzero_ps(); }
+    };
+
+    class ModelReferenceEffect;
+    class ShaderReferenceEffect;
+
+    template <class T>
+    class BSPointerHandle {
+    public:
+        BSPointerHandle() = default;
+        explicit BSPointerHandle(T* a_ptr) : ptr_(a_ptr) {}
+        [[nodiscard]] NiPointer<T> get() const { return NiPointer<T>(ptr_); }
+        void reset() { ptr_ = nullptr; }
+        explicit operator bool() const { return ptr_ != nullptr; }
+        [[nodiscard]] RefHandle native_handle() const { return 0; }
+        bool operator==(const BSPointerHandle&) const = default;
+
+    private:
+        T* ptr_ = nullptr;
+    };
+
+    using ObjectRefHandle = BSPointerHandle<TESObjectREFR>;
+
+    enum class ExtraDataType : std::uint32_t { kNone = 0, kStartingPosition = 0x0C, kCount = 0x24 };
+
+    class BGSLocation : public TESForm {};
+
+    class ExtraStartingPosition {
+    public:
+        static constexpr auto EXTRADATATYPE = ExtraDataType::kStartingPosition;
+        BGSLocation* location = nullptr;
+    };
+
+    class ExtraDataList {
+    public:
+        [[nodiscard]] std::int32_t GetCount() const { return count; }
+        void SetCount(const std::uint16_t a_count) { count = a_count; }
+        void SetOwner(TESForm*) {}
+        [[nodiscard]] bool HasType(ExtraDataType) const { return false; }
+
+        template <class T>
+        T* GetByType() const {
+            return nullptr;
+        }
+
+        std::int32_t count = 1;
+    };
+
+    class InventoryEntryData {
+    public:
+        [[nodiscard]] bool IsFavorited() const { return false; }
+        [[nodiscard]] bool IsWorn() const { return false; }
+        [[nodiscard]] bool IsQuestObject() const { return false; }
+
+        TESBoundObject* object = nullptr;
+        std::int32_t countDelta = 0;
+        std::list<ExtraDataList*>* extraLists = nullptr;
+    };
+
+    class InventoryChanges {
+    public:
+        void SetFavorite(InventoryEntryData*, ExtraDataList*) {}
+        std::list<InventoryEntryData*>* entryList = &entries;
+        std::list<InventoryEntryData*> entries;
+    };
+
+    class TESObjectREFR : public TESForm {
+    public:
+        using Count = std::int32_t;
+        using InventoryItemMap = std::map<TESBoundObject*, std::pair<Count, std::unique_ptr<InventoryEntryData>>>;
+
+        using TESForm::TESForm;
+
+        [[nodiscard]] TESBoundObject* GetBaseObject() const { return baseObject; }
+        [[nodiscard]] TESBoundObject* GetObjectReference() const { return baseObject; }
+        [[nodiscard]] ObjectRefHandle GetHandle() { return ObjectRefHandle(this); }
+        [[nodiscard]] ObjectRefHandle CreateRefHandle() { return ObjectRefHandle(this); }
+        ModelReferenceEffect* ApplyArtObject(BGSArtObject*, float = -1.f) { return nullptr; }
+        ShaderReferenceEffect* ApplyEffectShader(TESEffectShader*, float = -1.f) { return nullptr; }
+        [[nodiscard]] NiPoint3 GetPosition() const { return position; }
+        [[nodiscard]] TESObjectCELL* GetParentCell() const { return parentCell; }
+        [[nodiscard]] TESWorldSpace* GetWorldspace() const { return parentCell ? parentCell->worldSpace : nullptr; }
+        [[nodiscard]] NiAVObject* Get3D() const { return nullptr; }
+        [[nodiscard]] NiAVObject* GetCurrent3D() const { return nullptr; }
+        [[nodiscard]] NiAVObject* Get3D1(bool) const { return nullptr; }
+        [[nodiscard]] bool Is3DLoaded() const { return false; }
+        [[nodiscard]] bool HasContainer() const { return false; }
+        [[nodiscard]] bool IsDisabled() const { return false; }
+        [[nodiscard]] bool IsMarkedForDeletion() const { return false; }
+        [[nodiscard]] const char* GetDisplayFullName() const { return GetName(); }
+        [[nodiscard]] InventoryItemMap GetInventory() const { return {}; }
+        [[nodiscard]] InventoryChanges* GetInventoryChanges() { return &inventoryChanges; }
+        [[nodiscard]] bool IsPlayerRef() const { return formID == 0x14; }
+        void SetObjectReference(TESBoundObject* a_object) { baseObject = a_object; }
+        void Disable() {}
+        void Enable(bool) {}
+        [[nodiscard]] const char* GetName() const override { return baseObject ? baseObject->GetName() : ""; }
+
+        static NiPointer<TESObjectREFR> LookupByHandle(RefHandle) { return {}; }
+
+        TESBoundObject* baseObject = nullptr;
+        TESObjectCELL* parentCell = nullptr;
+        NiPoint3 position;
+        ExtraDataList extraList;
+        InventoryChanges inventoryChanges;
+    };
+
+    enum class ITEM_REMOVE_REASON { kRemove, kSteal, kSelling, kDropping, kStoreInContainer };
+
+    namespace MagicSystem {
+        enum class CastingSource { kLeftHand, kRightHand, kOther, kInstant };
+    }
+
+    class ActiveEffect {
+    public:
+        MagicItem* spell = nullptr;
+        float elapsedSeconds = 0.f;
+        float duration = 0.f;
+    };
+
+    class MagicTarget {
+    public:
+        [[nodiscard]] std::list<ActiveEffect*>* GetActiveEffectList() { return &activeEffects; }
+        std::list<ActiveEffect*> activeEffects;
+    };
+
+    class MagicCaster {
+    public:
+        void CastSpellImmediate(MagicItem*, bool, TESObjectREFR*, float, bool, float, void*) {}
+    };
+
+    template <class F>
+    void TESObjectCELL::ForEachReference(F&& a_callback) const {
+        for (const auto ref : references) {
+            if (a_callback(ref) == BSContainer::ForEachResult::kStop) return;
+        }
+    }
+
+    class Actor : public TESObjectREFR {
+    public:
+        using TESObjectREFR::TESObjectREFR;
+        static NiPointer<Actor> LookupByHandle(RefHandle) { return {}; }
+        TESObjectREFR* AsReference() { return this; }
+        [[nodiscard]] float GetHeight() const { return 128.f; }
+        [[nodiscard]] float GetAngleZ() const { return 0.f; }
+        [[nodiscard]] TESFaction* GetVendorFaction() const { return nullptr; }
+        MagicTarget* AsMagicTarget() { return &magicTarget; }
+        MagicCaster* GetMagicCaster(MagicSystem::CastingSource) { return &magicCaster; }
+        ObjectRefHandle RemoveItem(TESBoundObject*, std::int32_t, ITEM_REMOVE_REASON, ExtraDataList*, TESObjectREFR*,
+                                   const NiPoint3* = nullptr, const NiPoint3* = nullptr) {
+            return {};
+        }
+
+        MagicTarget magicTarget;
+        MagicCaster magicCaster;
+    };
+
+    class PlayerCharacter : public Actor {
+    public:
+        static PlayerCharacter* GetSingleton() {
+            static PlayerCharacter singleton(0x14, FormType::ActorCharacter);
+            return &singleton;
+        }
+
+        [[nodiscard]] bool WouldBeStealing(const TESObjectREFR*) const { return false; }
+
+    private:
+        using Actor::Actor;
+    };
+
+    class Calendar {
+    public:
+        static Calendar* GetSingleton() {
+            static Calendar singleton;
+            return &singleton;
+        }
+
+        [[nodiscard]] float GetHoursPassed() const { return hoursPassed; }
+        [[nodiscard]] float GetDaysPassed() const { return hoursPassed / 24.f; }
+        [[nodiscard]] float GetTimescale() const { return 20.f; }
+
+        // benchmark side
+        float hoursPassed = 0.f;
+    };
+
+    class BSSoundHandle {
+    public:
+        bool Play() { return false; }
+        bool Stop() { return false; }
+        bool SetVolume(float) { return false; }
+        bool FadeInPlay(std::uint16_t) { return false; }
+        bool FadeOutAndRelease(std::uint16_t) { return false; }
+        void SetObjectToFollow(NiAVObject*) {}
+        [[nodiscard]] bool IsValid() const { return false; }
+        [[nodiscard]] bool IsPlaying() const { return false; }
+        std::uint32_t soundID = static_cast<std::uint32_t>(-1);
+    };
+
+    class ReferenceEffect {
+    public:
+        virtual ~ReferenceEffect() = default;
+        ObjectRefHandle target;
+        bool finished = false;
+        float lifetime = 0.f;
+        float age = 0.f;
+    };
+
+    class ModelReferenceEffect : public ReferenceEffect {
+    public:
+        BGSArtObject* artObject = nullptr;
+    };
+
+    class ShaderReferenceEffect : public ReferenceEffect {
+    public:
+        TESEffectShader* effectData = nullptr;
+    };
+
+    class ProcessLists {
+    public:
+        static ProcessLists* GetSingleton() { return nullptr; }
+
+        template <class F>
+        void ForEachModelEffect(F&&) {}
+
+        template <class F>
+        void ForEachShaderEffect(F&&) {}
+    };
+
+    class BSAudioManager {
+    public:
+        static BSAudioManager* GetSingleton() { return nullptr; }
+        bool BuildSoundDataFromDescriptor(BSSoundHandle&, BGSSoundDescriptorForm*, std::uint32_t = 0) { return false; }
+    };
+
+    class IFormFactory {
+    public:
+        static IFormFactory* GetFormFactoryByType(FormType) { return nullptr; }
+        TESForm* Create() { return nullptr; }
+    };
+
+    inline const char* FormTypeToString(const FormType a_type) {
+        switch (a_type) {
+            case FormType::AlchemyItem:
+                return "ALCH";
+            case FormType::Ingredient:
+                return "INGR";
+            case FormType::Misc:
+                return "MISC";
+            case FormType::Book:
+                return "BOOK";
+            case FormType::Weapon:
+                return "WEAP";
+            case FormType::Armor:
+                return "ARMO";
+            case FormType::Ammo:
+                return "AMMO";
+            case FormType::Reference:
+                return "REFR";
+            default:
+                return "NONE";
+        }
+    }
+
+    class StandardItemData {
+    public:
+        RefHandle owner = 0;
+    };
+
+    class ItemList {
+    public:
+        struct Item {
+            StandardItemData data;
+        };
+        Item* GetSelectedItem() { return nullptr; }
+        void Update() {}
+    };
+
+    template <const char* Name>
+    class ItemMenu_ {
+    public:
+        static constexpr std::string_view MENU_NAME = Name;
+
+        struct RuntimeData {
+            ItemList* itemList = nullptr;
+        };
+
+        RuntimeData& GetRuntimeData() { return runtimeData; }
+        [[nodiscard]] RefHandle GetTargetRefHandle() const { return 0; }
+
+        RuntimeData runtimeData;
+    };
+
+    inline constexpr char InventoryMenuName_[] = "InventoryMenu";
+    inline constexpr char ContainerMenuName_[] = "ContainerMenu";
+    inline constexpr char BarterMenuName_[] = "BarterMenu";
+
+    class InventoryMenu : public ItemMenu_<InventoryMenuName_> {};
+    class ContainerMenu : public ItemMenu_<ContainerMenuName_> {};
+    class BarterMenu : public ItemMenu_<BarterMenuName_> {};
+
+    class ActorEquipManager {
+    public:
+        static ActorEquipManager* GetSingleton() {
+            static ActorEquipManager singleton;
+            return &singleton;
+        }
+
+        void EquipObject(Actor*, TESBoundObject*, ExtraDataList*, std::uint32_t, const void*, bool, bool, bool, bool) {}
+        void UnequipObject(Actor*, TESBoundObject*, ExtraDataList*, std::uint32_t, const void*, bool, bool, bool) {}
+    };
+
+    class TESDataHandler {
+    public:
+        static TESDataHandler* GetSingleton() {
+            static TESDataHandler singleton;
+            return &singleton;
+        }
+
+        ObjectRefHandle CreateReferenceAtLocation(TESBoundObject*, const NiPoint3&, const NiPoint3&, TESObjectCELL*,
+                                                  TESWorldSpace*, TESObjectREFR*, void*, ObjectRefHandle, bool, bool) {
+            return {};
+        }
+    };
+
+    class UI {
+    public:
+        static UI* GetSingleton() { return nullptr; }
+
+        template <class T>
+        T* GetMenu() {
+            return nullptr;
+        }
+
+        [[nodiscard]] bool IsMenuOpen(std::string_view) const { return false; }
+    };
+
+    inline void DebugMessageBox(const char*) {}
+    inline void DebugNotification(const char*, const char* = nullptr, bool = true) {}
+}
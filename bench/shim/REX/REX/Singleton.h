@@ -0,0 +1,21 @@
+#pragma once
+
+namespace REX {
+    template <class T>
+    class Singleton {
+    public:
+        static T* GetSingleton() {
+            static T singleton;
+            return &singleton;
+        }
+
+    protected:
+        Singleton() = default;
+        ~Singleton() = default;
+
+        Singleton(const Singleton&) = delete;
+        Singleton(Singleton&&) = delete;
+        Singleton& operator=(const Singleton&) = delete;
+        Singleton& operator=(Singleton&&) = delete;
+    };
+}
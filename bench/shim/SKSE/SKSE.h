@@ -0,0 +1,80 @@
+#pragma once
+#include "RE/Skyrim.h"
+
+#include <spdlog/spdlog.h>
+
+// Headless stand-in for the parts of SKSE the stage-evolution core touches. Logging is swallowed; set
+// SKSE::log::echo to print it while debugging a benchmark.
+namespace SKSE {
+    namespace log {
+        inline bool echo = false;
+
+        inline std::optional<std::filesystem::path> log_directory() { return std::filesystem::temp_directory_path(); }
+
+        template <class... Args>
+        void Write_(const char* level, fmt::format_string<Args...> a_fmt, Args&&... a_args) {
+            if (echo) fmt::print(stderr, "[{}] {}\n", level, fmt::format(a_fmt, std::forward<Args>(a_args)...));
+        }
+
+        template <class... Args>
+        void trace(fmt::format_string<Args...> a_fmt, Args&&... a_args) {
+            Write_("trace", a_fmt, std::forward<Args>(a_args)...);
+        }
+
+        template <class... Args>
+        void debug(fmt::format_string<Args...> a_fmt, Args&&... a_args) {
+            Write_("debug", a_fmt, std::forward<Args>(a_args)...);
+        }
+
+        template <class... Args>
+        void info(fmt::format_string<Args...> a_fmt, Args&&... a_args) {
+            Write_("info", a_fmt, std::forward<Args>(a_args)...);
+        }
+
+        template <class... Args>
+        void warn(fmt::format_string<Args...> a_fmt, Args&&... a_args) {
+            Write_("warn", a_fmt, std::forward<Args>(a_args)...);
+        }
+
+        template <class... Args>
+        void error(fmt::format_string<Args...> a_fmt, Args&&... a_args) {
+            Write_("error", a_fmt, std::forward<Args>(a_args)...);
+        }
+
+        template <class... Args>
+        void critical(fmt::format_string<Args...> a_fmt, Args&&... a_args) {
+            Write_("critical", a_fmt, std::forward<Args>(a_args)...);
+        }
+    }
+
+    namespace stl {
+        [[noreturn]] inline void report_and_fail(const std::string_view a_msg) {
+            fmt::print(stderr, "{}\n", a_msg);
+            std::abort();
+        }
+    }
+
+    class PluginDeclaration {
+    public:
+        static PluginDeclaration* GetSingleton() {
+            static PluginDeclaration singleton;
+            return &singleton;
+        }
+
+        [[nodiscard]] std::string_view GetName() const { return "AlchemyOfTime"; }
+        [[nodiscard]] REL::Version GetVersion() const { return {}; }
+    };
+
+    class SerializationInterface;
+
+    class TaskInterface {
+    public:
+        template <class F>
+        void AddTask(F&& a_task) const { a_task(); }
+    };
+
+    inline const TaskInterface* GetTaskInterface() {
+        static TaskInterface singleton;
+        return &singleton;
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+// Only the declarations MCP.h needs to parse; nothing is rendered headlessly.
+#ifndef __stdcall
+#define __stdcall
+#endif
+
+namespace ImGuiMCP {
+    struct ImGuiTextFilter;
+
+    using ImGuiTableFlags = int;
+    enum ImGuiTableFlags_ : int {
+        ImGuiTableFlags_None = 0,
+        ImGuiTableFlags_Resizable = 1 << 0,
+        ImGuiTableFlags_RowBg = 1 << 6,
+        ImGuiTableFlags_Borders = 0xF << 7,
+        ImGuiTableFlags_SizingFixedFit = 1 << 13,
+        ImGuiTableFlags_SizingStretchProp = 3 << 13
+    };
+}
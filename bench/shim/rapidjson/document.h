@@ -0,0 +1,14 @@
+#pragma once
+// Declarations only: the benchmarks never (de)serialise presets, they just need Settings.h to parse.
+namespace rapidjson {
+    class CrtAllocator;
+    template <class BaseAllocator = CrtAllocator>
+    class MemoryPoolAllocator;
+
+    class Value;
+
+    class Document {
+    public:
+        using AllocatorType = MemoryPoolAllocator<>;
+    };
+}
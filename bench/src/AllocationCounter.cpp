@@ -0,0 +1,34 @@
+// Counting replacements of the global allocation functions, for allocs/op. They only exist in the benchmark
+// executable; the plugin itself never replaces the game's allocator.
+#include <cstdlib>
+#include <new>
+
+#include "Bench.h"
+#include "Profiler.h"
+
+namespace {
+    thread_local uint64_t t_allocations = 0;
+
+    void* Allocate(const std::size_t size) {
+        ++t_allocations;
+        if (void* p = std::malloc(size ? size : 1)) return p;
+        throw std::bad_alloc();
+    }
+
+    // so AOT_PROFILE builds of the sources report allocs/op per site as well
+    [[maybe_unused]] const bool installed = [] {
+        Profiler::SetAllocationCounter(&Bench::ThreadAllocations);
+        return true;
+    }();
+}
+
+uint64_t Bench::ThreadAllocations() {
+    return t_allocations;
+}
+
+void* operator new(const std::size_t size) { return Allocate(size); }
+void* operator new[](const std::size_t size) { return Allocate(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
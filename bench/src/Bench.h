@@ -0,0 +1,59 @@
+#pragma once
+#include <benchmark/benchmark.h>
+
+#include "Data.h"
+
+namespace Bench {
+    // Allocations made by the calling thread so far (operator new is replaced in this executable only).
+    uint64_t ThreadAllocations();
+
+    // Counts the allocations of the timed part of a benchmark and reports them as allocs/op.
+    class AllocationMeter {
+    public:
+        explicit AllocationMeter(benchmark::State& a_state) : state_(a_state), start_(ThreadAllocations()) {}
+
+        // Call around untimed setup together with PauseTiming / ResumeTiming.
+        void Pause() { total_ += ThreadAllocations() - start_; }
+        void Resume() { start_ = ThreadAllocations(); }
+
+        ~AllocationMeter() {
+            total_ += ThreadAllocations() - start_;
+            state_.counters["allocs/op"] =
+                benchmark::Counter(static_cast<double>(total_), benchmark::Counter::kAvgIterations);
+        }
+
+        AllocationMeter(const AllocationMeter&) = delete;
+        AllocationMeter& operator=(const AllocationMeter&) = delete;
+
+    private:
+        benchmark::State& state_;
+        uint64_t start_;
+        uint64_t total_ = 0;
+    };
+
+    // Forms the synthetic sources are built from. They are registered with the shimmed RE::TESForm table and live
+    // as long as the process.
+    class SyntheticWorld {
+    public:
+        static SyntheticWorld& Get();
+
+        // A FOOD source whose stages (stage_hours each) are all real forms, decaying into one more form.
+        std::unique_ptr<Source> MakeSource(StageNo n_stages = 4, float stage_hours = 24.f);
+
+    private:
+        RE::AlchemyItem* MakeItem_(const std::string& a_editorID);
+
+        std::vector<std::unique_ptr<RE::TESForm>> forms_;
+        FormID next_formid_ = 0x00010000;
+    };
+
+    // Locations get consecutive RefIDs from here on; nothing looks them up.
+    inline constexpr RefID first_location = 0x00100000;
+
+    // Inserts n_instances stage-0 instances into a_source, per_location to a location, started at random times
+    // in [0, spread) hours (seeded, so every run builds the same data). Returns the locations used.
+    std::vector<RefID> Populate(Source& a_source, size_t n_instances, size_t per_location, float spread,
+                                uint32_t seed = 1);
+
+    void SetHoursPassed(float a_hours);
+}
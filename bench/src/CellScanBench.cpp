@@ -0,0 +1,109 @@
+// Nearby-modulator search: CellScanner::BaseIndex::QueryNearest over 10k to 100k cached entries of one base, against
+// the per-entry scalar filter it used before the per-axis arrays. Entries are spread over a 40k x 40k x 2k box (about
+// a tenth of Tamriel); a query at the default search radius keeps about one entry in a thousand.
+#include "Bench.h"
+#include "CellScan.h"
+
+namespace {
+    constexpr float extent_xy = 40000.f;
+    constexpr float extent_z = 2000.f;
+    constexpr float radius = 1000.f;
+    constexpr size_t n_queries = 64;
+
+    struct Scene {
+        CellScanner::BaseIndex index;
+        std::vector<RE::NiPoint3> origins;
+    };
+
+    // a_cellSize 0 leaves the index ungridded, so every query runs the distance filter over all entries
+    Scene MakeScene(const size_t n_entries, const float a_cellSize) {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> xy(0.f, extent_xy);
+        std::uniform_real_distribution<float> z(0.f, extent_z);
+        Scene scene;
+        scene.index.entries.reserve(n_entries);
+        for (size_t i = 0; i < n_entries; ++i) {
+            scene.index.entries.push_back({static_cast<RefID>(0x00200000 + i), {xy(rng), xy(rng), z(rng)}});
+        }
+        scene.index.Build(a_cellSize);
+        for (size_t i = 0; i < n_queries; ++i) scene.origins.emplace_back(xy(rng), xy(rng), z(rng));
+        return scene;
+    }
+
+    // QueryNearest's full scan before the kernel: one entry at a time from the array of structs
+    void ScalarQuery(const CellScanner::BaseIndex& a_index, const RE::NiPoint3& origin, const float a_radius,
+                     std::vector<CellScanner::Hit>& out) {
+        out.clear();
+        const float r2 = a_radius * a_radius;
+        for (const auto& e : a_index.entries) {
+            const float dx = e.pos.x - origin.x;
+            const float dy = e.pos.y - origin.y;
+            const float dz = e.pos.z - origin.z;
+            if (const float d2 = dx * dx + dy * dy + dz * dz; d2 <= r2) {
+                out.push_back({d2, &e});
+            }
+        }
+        std::ranges::sort(out, {}, &CellScanner::Hit::d2);
+    }
+
+    void EntryCounts(benchmark::internal::Benchmark* b) {
+        b->Arg(10'000)->Arg(30'000)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+    }
+
+    // one iteration runs n_queries queries; items are entries filtered
+    void BM_QueryNearestKernel(benchmark::State& state) {
+        const auto n = static_cast<size_t>(state.range(0));
+        const auto scene = MakeScene(n, 0.f);
+        std::vector<CellScanner::Hit> hits, expected;
+        size_t survivors = 0;
+        for (const auto& origin : scene.origins) {
+            scene.index.QueryNearest(origin, radius, hits);
+            ScalarQuery(scene.index, origin, radius, expected);
+            if (hits.size() != expected.size() || !std::ranges::equal(hits, expected, {}, &CellScanner::Hit::entry,
+                                                                      &CellScanner::Hit::entry)) {
+                state.SkipWithError("kernel disagrees with the scalar filter");
+                return;
+            }
+            survivors += hits.size();
+        }
+        state.counters["hits/query"] = static_cast<double>(survivors) / n_queries;
+        for (auto _ : state) {
+            for (const auto& origin : scene.origins) {
+                scene.index.QueryNearest(origin, radius, hits);
+                benchmark::DoNotOptimize(hits.data());
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n_queries * n));
+    }
+
+    void BM_QueryNearestScalar(benchmark::State& state) {
+        const auto n = static_cast<size_t>(state.range(0));
+        const auto scene = MakeScene(n, 0.f);
+        std::vector<CellScanner::Hit> hits;
+        for (auto _ : state) {
+            for (const auto& origin : scene.origins) {
+                ScalarQuery(scene.index, origin, radius, hits);
+                benchmark::DoNotOptimize(hits.data());
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n_queries * n));
+    }
+
+    // what the plugin runs: gridded by the search radius, so only the 27 cells around the origin are filtered
+    void BM_QueryNearestGridded(benchmark::State& state) {
+        const auto n = static_cast<size_t>(state.range(0));
+        const auto scene = MakeScene(n, radius);
+        std::vector<CellScanner::Hit> hits;
+        for (auto _ : state) {
+            for (const auto& origin : scene.origins) {
+                scene.index.QueryNearest(origin, radius, hits);
+                benchmark::DoNotOptimize(hits.data());
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n_queries));
+    }
+}
+
+BENCHMARK(BM_QueryNearestKernel)->Apply(EntryCounts);
+BENCHMARK(BM_QueryNearestScalar)->Apply(EntryCounts);
+BENCHMARK(BM_QueryNearestGridded)->Apply(EntryCounts);
@@ -0,0 +1,137 @@
+// Source::MoveInstances on one large stack against the per-instance loop it replaced. All N instances sit at one
+// location, as in a container that has been collecting the same food for a long time.
+#include "Bench.h"
+
+namespace {
+    constexpr RefID to_location = Bench::first_location + 0x00800000;
+
+    // The pre-batch Source::MoveInstances: re-evaluates GetElapsed inside the sort comparator, then moves one
+    // instance at a time, each with a vector::erase and an O(k) fix-up of the indices removed so far. The in-place
+    // split reindexes its slot, which the stage index (added later) needs.
+    Count LegacyMoveInstances(Source& a_source, const RefID from_ref, const RefID to_ref, const FormID instance_formid,
+                              Count count, const bool older_first) {
+        std::vector<size_t> instances_candidates = {};
+        size_t index_ = 0;
+        for (const auto& st_inst : a_source.data.at(from_ref)) {
+            if (st_inst.xtra.form_id == instance_formid && st_inst.count > 0) {
+                instances_candidates.push_back(index_);
+            }
+            index_++;
+        }
+
+        if (instances_candidates.empty()) return count;
+
+        const auto curr_time = RE::Calendar::GetSingleton()->GetHoursPassed();
+        if (older_first) {
+            std::ranges::sort(instances_candidates, [&a_source, from_ref, curr_time](const size_t a, const size_t b) {
+                return a_source.data.at(from_ref)[a].GetElapsed(curr_time) >
+                       a_source.data.at(from_ref)[b].GetElapsed(curr_time);
+            });
+        } else {
+            std::ranges::sort(instances_candidates, [&a_source, from_ref, curr_time](const size_t a, const size_t b) {
+                return a_source.data.at(from_ref)[a].GetElapsed(curr_time) <
+                       a_source.data.at(from_ref)[b].GetElapsed(curr_time);
+            });
+        }
+
+        std::vector<size_t> removed_indices;
+        for (const size_t index : instances_candidates) {
+            if (!count) break;
+
+            size_t shift = 0;
+            for (const size_t removed_index : removed_indices) {
+                if (index > removed_index) shift++;
+            }
+            const auto slot = index - shift;
+            StageInstance* instance = &a_source.data.at(from_ref)[slot];
+
+            if (count <= instance->count) {
+                const auto indexed = Source::IndexedStateOf(*instance);
+                instance->count -= count;
+                a_source.ReindexSlot(from_ref, static_cast<uint32_t>(slot), indexed);
+                StageInstance new_instance(*instance);
+                new_instance.count = count;
+                if (to_ref > 0 && !a_source.InsertNewInstance(new_instance, to_ref)) return 0;
+                count = 0;
+            } else {
+                const auto count_temp = count;
+                count -= instance->count;
+                if (!a_source.MoveInstance(from_ref, to_ref, instance)) return count_temp;
+                removed_indices.push_back(index);
+            }
+        }
+        return count;
+    }
+
+    using MoveFn = Count (*)(Source&, RefID, RefID, FormID, Count, bool);
+
+    Count BatchedMoveInstances(Source& a_source, const RefID from_ref, const RefID to_ref,
+                               const FormID instance_formid, const Count count, const bool older_first) {
+        return a_source.MoveInstances(from_ref, to_ref, instance_formid, count, older_first);
+    }
+
+    // (start time, count) of the live instances Move leaves at each end, in a canonical order
+    template <MoveFn Move>
+    std::pair<std::vector<std::pair<float, Count>>, std::vector<std::pair<float, Count>>> MoveResult(
+        const size_t n, const bool take_all) {
+        Bench::SetHoursPassed(0.f);
+        auto source = Bench::SyntheticWorld::Get().MakeSource();
+        const auto from = Bench::Populate(*source, n, n, 12.f).front();
+        Bench::SetHoursPassed(12.f);
+        const auto stage_formid = source->GetStage(0).formid;
+        const auto total = source->FindStageSlots(from, stage_formid)->total;
+        Move(*source, from, to_location, stage_formid, take_all ? total : total / 2, true);
+        const auto rows = [&source](const RefID loc) {
+            std::vector<std::pair<float, Count>> out;
+            if (const auto it = source->data.find(loc); it != source->data.end()) {
+                for (const auto& instance : it->second) {
+                    // the per-instance loop leaves an instance it took exactly in place with count 0
+                    if (instance.count > 0) out.emplace_back(instance.start_time, instance.count);
+                }
+            }
+            std::ranges::sort(out);
+            return out;
+        };
+        return {rows(from), rows(to_location)};
+    }
+
+    // range(0): instances in the stack; range(1): 1 to take the whole stack, 0 to take the older half by count
+    template <MoveFn Move>
+    void BM_MoveStack(benchmark::State& state) {
+        const auto n = static_cast<size_t>(state.range(0));
+        const bool take_all = state.range(1) != 0;
+        if (MoveResult<Move>(n, take_all) != MoveResult<LegacyMoveInstances>(n, take_all)) {
+            state.SkipWithError("moved other instances than the per-instance loop");
+            return;
+        }
+        Bench::AllocationMeter allocs(state);
+        for (auto _ : state) {
+            state.PauseTiming();
+            allocs.Pause();
+            Bench::SetHoursPassed(0.f);
+            auto source = Bench::SyntheticWorld::Get().MakeSource();
+            const auto from = Bench::Populate(*source, n, n, 12.f).front();
+            Bench::SetHoursPassed(12.f);
+            const auto stage_formid = source->GetStage(0).formid;
+            const auto total = source->FindStageSlots(from, stage_formid)->total;
+            allocs.Resume();
+            state.ResumeTiming();
+
+            benchmark::DoNotOptimize(Move(*source, from, to_location, stage_formid, take_all ? total : total / 2, true));
+
+            state.PauseTiming();
+            allocs.Pause();
+            source.reset();
+            allocs.Resume();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    void StackSizes(benchmark::internal::Benchmark* b) {
+        b->ArgNames({"n", "all"})->ArgsProduct({{64, 512, 4096, 32768}, {0, 1}})->Unit(benchmark::kMicrosecond);
+    }
+}
+
+BENCHMARK(BM_MoveStack<BatchedMoveInstances>)->Name("BM_MoveStack/batched")->Apply(StackSizes);
+BENCHMARK(BM_MoveStack<LegacyMoveInstances>)->Name("BM_MoveStack/per_instance")->Apply(StackSizes);
@@ -0,0 +1,101 @@
+// PresetCodec round trip on a preset the size of a large QFORM default file: every stage map filled, a few dozen
+// delayers and transformers. Before timing, the decoded settings are checked field by field against the encoded ones.
+#include "Bench.h"
+#include "PresetCodec.h"
+
+bool operator==(const StageEffect& a, const StageEffect& b) {
+    return a.beffect == b.beffect && a.magnitude == b.magnitude && a.duration == b.duration;
+}
+
+namespace {
+    // Walks a with the codec's own field list and compares each field with the one at the same offset in b,
+    // so a field added to the codec is compared without touching this file.
+    class CompareArchive {
+    public:
+        CompareArchive(const DefaultSettings& a, const DefaultSettings& b)
+            : a_(reinterpret_cast<const char*>(&a)), b_(reinterpret_cast<const char*>(&b)) {}
+
+        template <class T>
+        void operator()(const T& field) {
+            const auto offset = reinterpret_cast<const char*>(&field) - a_;
+            equal_ = equal_ && field == *reinterpret_cast<const T*>(b_ + offset);
+        }
+
+        [[nodiscard]] bool equal() const { return equal_; }
+
+    private:
+        const char* a_;
+        const char* b_;
+        bool equal_ = true;
+    };
+
+    bool Equal(const DefaultSettings& a, const DefaultSettings& b) {
+        CompareArchive ar(a, b);
+        PresetCodec::VisitAddOn(ar, static_cast<const AddOnSettings&>(a));
+        PresetCodec::VisitDefault(ar, a);
+        return ar.equal();
+    }
+
+    DefaultSettings MakePreset(const size_t n_modulators) {
+        std::mt19937 rng(5);
+        std::uniform_int_distribution<FormID> form(0x00000800, 0x00FFFFFF);
+        DefaultSettings s;
+        for (StageNo no = 0; no < 6; ++no) {
+            s.items[no] = form(rng);
+            s.durations[no] = 24.f * static_cast<float>(no + 1);
+            s.stage_names[no] = std::format("Stage {} of a long preset name", no);
+            s.crafting_allowed[no] = no % 2 == 0;
+            s.costoverrides[no] = static_cast<int>(no) * 3 - 1;
+            s.weightoverrides[no] = 0.25f * static_cast<float>(no);
+            s.effects[no] = {StageEffect(form(rng), 1.5f, 30), StageEffect(form(rng), 0.f, 0)};
+            s.numbers.push_back(no);
+            s.colors[no] = 0x00FF0000u >> no;
+            s.sounds[no] = form(rng);
+            s.artobjects[no] = form(rng);
+            s.effect_shaders[no] = form(rng);
+        }
+        s.decayed_id = form(rng);
+        for (size_t i = 0; i < n_modulators; ++i) {
+            const auto delayer = form(rng);
+            s.delayers[delayer] = 0.5f + static_cast<float>(i);
+            s.delayers_order.insert(delayer);
+            s.delayer_colors[delayer] = 0x0000FF00u;
+            s.delayer_sounds[delayer] = form(rng);
+            s.delayer_containers[delayer] = {form(rng), form(rng)};
+            s.delayer_allowed_stages[delayer] = {0, 2, 4};
+
+            const auto transformer = form(rng);
+            s.transformers[transformer] = {form(rng), 12.f};
+            s.transformers_order.insert(transformer);
+            s.transformer_effect_shaders[transformer] = form(rng);
+            s.transformer_allowed_stages[transformer] = {1, 3};
+            s.containers.insert(form(rng));
+        }
+        return s;
+    }
+
+    void BM_PresetEncode(benchmark::State& state) {
+        const auto preset = MakePreset(static_cast<size_t>(state.range(0)));
+        const auto payload = PresetCodec::Encode(preset);
+        if (DefaultSettings decoded; !PresetCodec::Decode(payload, decoded) || !Equal(preset, decoded)) {
+            state.SkipWithError("decoded preset differs from the encoded one");
+            return;
+        }
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(PresetCodec::Encode(preset).data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+    }
+
+    void BM_PresetDecode(benchmark::State& state) {
+        const auto payload = PresetCodec::Encode(MakePreset(static_cast<size_t>(state.range(0))));
+        for (auto _ : state) {
+            DefaultSettings decoded;
+            benchmark::DoNotOptimize(PresetCodec::Decode(payload, decoded));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.size()));
+    }
+}
+
+BENCHMARK(BM_PresetEncode)->Arg(4)->Arg(64)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PresetDecode)->Arg(4)->Arg(64)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,146 @@
+// Settings loading shape on the shared TaskScheduler against the per-call thread pools it replaced: one task per
+// form type, each forking a task per custom file and then per addon file, joined before the type task returns.
+// The file tasks spin instead of parsing YAML, so only the scheduling differs.
+#include "Bench.h"
+#include "Threading.h"
+
+#include <future>
+#include <queue>
+
+namespace {
+    constexpr size_t n_types = 10;
+
+    // ThreadPool as Threading.h had it: one mutex-and-condvar queue of std::function, threads joined on destruction
+    class LegacyThreadPool {
+    public:
+        static inline std::atomic<size_t> threads_started{0};
+
+        explicit LegacyThreadPool(const size_t a_numThreads) {
+            threads_started.fetch_add(a_numThreads, std::memory_order_relaxed);
+            for (size_t i = 0; i < a_numThreads; ++i) {
+                workers.emplace_back([this] {
+                    while (true) {
+                        std::function<void()> task;
+                        {
+                            std::unique_lock lock(queueMutex);
+                            condition.wait(lock, [this] { return stop || !tasks.empty(); });
+                            if (stop && tasks.empty()) return;
+                            task = std::move(tasks.front());
+                            tasks.pop();
+                        }
+                        task();
+                    }
+                });
+            }
+        }
+
+        ~LegacyThreadPool() {
+            {
+                std::unique_lock lock(queueMutex);
+                stop = true;
+            }
+            condition.notify_all();
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+        }
+
+        template <class F>
+        std::future<void> enqueue(F&& f) {
+            auto task = std::make_shared<std::packaged_task<void()>>(std::forward<F>(f));
+            std::future<void> res = task->get_future();
+            {
+                std::unique_lock lock(queueMutex);
+                tasks.emplace([task]() { (*task)(); });
+            }
+            condition.notify_one();
+            return res;
+        }
+
+    private:
+        std::vector<std::thread> workers;
+        std::queue<std::function<void()>> tasks;
+        std::mutex queueMutex;
+        std::condition_variable condition;
+        bool stop = false;
+    };
+
+    // stands in for parsing one preset file; about a microsecond per unit
+    void ParseFile(const int64_t a_units) {
+        uint64_t x = 88172645463325252ull;
+        for (int64_t i = 0; i < a_units * 400; ++i) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+        }
+        benchmark::DoNotOptimize(x);
+    }
+
+    void LegacyParseFiles(const int64_t a_files, const int64_t a_units) {
+        std::vector<std::future<void>> futures;
+        LegacyThreadPool pool(numThreads);
+        for (int64_t f = 0; f < a_files; ++f) {
+            futures.emplace_back(pool.enqueue([a_units] { ParseFile(a_units); }));
+        }
+        for (auto& fut : futures) fut.get();
+    }
+
+    void LegacyLoadSettings(const int64_t a_files, const int64_t a_units) {
+        std::vector<std::future<void>> typeFutures;
+        LegacyThreadPool typePool(numThreads);
+        for (size_t t = 0; t < n_types; ++t) {
+            typeFutures.push_back(typePool.enqueue([a_files, a_units] {
+                LegacyParseFiles(a_files, a_units); // customs
+                LegacyParseFiles(a_files, a_units); // addons
+            }));
+        }
+        for (auto& fut : typeFutures) fut.get();
+    }
+
+    void SchedulerParseFiles(const int64_t a_files, const int64_t a_units) {
+        TaskGroup group;
+        for (int64_t f = 0; f < a_files; ++f) {
+            group.Run([a_units] { ParseFile(a_units); });
+        }
+        group.Wait();
+    }
+
+    void SchedulerLoadSettings(const int64_t a_files, const int64_t a_units) {
+        TaskGroup typeGroup;
+        for (size_t t = 0; t < n_types; ++t) {
+            typeGroup.Run([a_files, a_units] {
+                SchedulerParseFiles(a_files, a_units);
+                SchedulerParseFiles(a_files, a_units);
+            });
+        }
+        typeGroup.Wait();
+    }
+
+    // range(0): files per type and kind; range(1): work units per file
+    void BM_LoadShapeLegacyPools(benchmark::State& state) {
+        LegacyThreadPool::threads_started = 0;
+        for (auto _ : state) {
+            LegacyLoadSettings(state.range(0), state.range(1));
+        }
+        state.counters["threads/op"] = benchmark::Counter(static_cast<double>(LegacyThreadPool::threads_started),
+                                                          benchmark::Counter::kAvgIterations);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n_types * 2 * state.range(0)));
+    }
+
+    void BM_LoadShapeScheduler(benchmark::State& state) {
+        TaskScheduler::Get(); // workers start outside the timed region, once per process
+        for (auto _ : state) {
+            SchedulerLoadSettings(state.range(0), state.range(1));
+        }
+        state.counters["threads/op"] = 0;
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n_types * 2 * state.range(0)));
+    }
+
+    void Shapes(benchmark::internal::Benchmark* b) {
+        b->ArgNames({"files", "units"})->ArgsProduct({{4, 32, 128}, {1, 50}})->UseRealTime()
+         ->Unit(benchmark::kMicrosecond);
+    }
+}
+
+BENCHMARK(BM_LoadShapeLegacyPools)->Apply(Shapes);
+BENCHMARK(BM_LoadShapeScheduler)->Apply(Shapes);
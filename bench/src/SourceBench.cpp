@@ -0,0 +1,111 @@
+// Source hot paths on synthetic data: N instances of one source, 50 to a location like a well-stocked container.
+// Mutating benchmarks rebuild the source outside the timed region every iteration.
+#include "Bench.h"
+
+namespace {
+    constexpr StageNo n_stages = 4;
+    constexpr float stage_hours = 24.f;
+    constexpr size_t per_location = 50;
+
+    struct Fixture {
+        std::unique_ptr<Source> source;
+        std::vector<RefID> locations;
+
+        // start times in [0, spread) hours; the clock is left at 0
+        explicit Fixture(const size_t n_instances, const float spread = n_stages * stage_hours) {
+            Bench::SetHoursPassed(0.f);
+            source = Bench::SyntheticWorld::Get().MakeSource(n_stages, stage_hours);
+            locations = Bench::Populate(*source, n_instances, per_location, spread);
+        }
+    };
+
+    // Runs a_op on a fresh Fixture every iteration, timing and counting only a_op.
+    template <class Setup, class Op>
+    void RunMutating(benchmark::State& state, const float spread, Setup a_setup, Op a_op) {
+        const auto n = static_cast<size_t>(state.range(0));
+        Bench::AllocationMeter allocs(state);
+        std::optional<Fixture> fx;
+        for (auto _ : state) {
+            state.PauseTiming();
+            allocs.Pause();
+            fx.emplace(n, spread);
+            a_setup(*fx);
+            allocs.Resume();
+            state.ResumeTiming();
+
+            a_op(*fx);
+
+            state.PauseTiming();
+            allocs.Pause();
+            fx.reset();
+            allocs.Resume();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    void Sizes(benchmark::internal::Benchmark* b) {
+        b->RangeMultiplier(10)->Range(1'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+    }
+
+    // Every location catches up one and a half stages' worth of time, so each instance moves on at least once.
+    void BM_UpdateAllStages(benchmark::State& state) {
+        RunMutating(state, n_stages * stage_hours, [](Fixture&) {}, [](Fixture& fx) {
+            for (const auto loc : fx.locations) {
+                benchmark::DoNotOptimize(fx.source->UpdateAllStages(loc, n_stages * stage_hours * 1.5f));
+            }
+        });
+    }
+
+    void BM_GetNextUpdateTime(benchmark::State& state) {
+        const auto n = static_cast<size_t>(state.range(0));
+        const Fixture fx(n);
+        const Source& source = *fx.source;
+        Bench::AllocationMeter allocs(state);
+        for (auto _ : state) {
+            for (const auto& instances : source.data | std::views::values) {
+                for (const auto& instance : instances) {
+                    benchmark::DoNotOptimize(source.GetNextUpdateTime(&instance));
+                }
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    // Start times only minutes apart, so part of every location merges; nothing is due for removal.
+    void BM_CleanUpData(benchmark::State& state) {
+        RunMutating(state, 2.f, [](Fixture&) { Bench::SetHoursPassed(stage_hours / 2.f); },
+                    [](Fixture& fx) { fx.source->CleanUpData(); });
+    }
+
+    // Takes the older half (by count) of every location's first-stage items into another container, which splits
+    // one stack per location.
+    void BM_MoveInstances(benchmark::State& state) {
+        std::vector<Count> halves;
+        RunMutating(state, stage_hours / 2.f, [&halves](Fixture& fx) {
+            Bench::SetHoursPassed(stage_hours / 2.f);
+            const auto stage_formid = fx.source->GetStage(0).formid;
+            halves.clear();
+            for (const auto loc : fx.locations) {
+                Count total = 0;
+                for (const auto& instance : fx.source->data.at(loc)) {
+                    if (instance.xtra.form_id == stage_formid) total += instance.count;
+                }
+                halves.push_back(total / 2);
+            }
+        }, [&halves](Fixture& fx) {
+            const auto stage_formid = fx.source->GetStage(0).formid;
+            for (size_t i = 0; i < fx.locations.size(); ++i) {
+                if (!halves[i]) continue;
+                const auto from = fx.locations[i];
+                benchmark::DoNotOptimize(
+                    fx.source->MoveInstances(from, from + 0x00800000, stage_formid, halves[i], true));
+            }
+        });
+    }
+}
+
+BENCHMARK(BM_UpdateAllStages)->Apply(Sizes);
+BENCHMARK(BM_GetNextUpdateTime)->Apply(Sizes);
+BENCHMARK(BM_CleanUpData)->Apply(Sizes);
+BENCHMARK(BM_MoveInstances)->Apply(Sizes);
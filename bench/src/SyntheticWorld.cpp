@@ -0,0 +1,55 @@
+#include "Bench.h"
+
+Bench::SyntheticWorld& Bench::SyntheticWorld::Get() {
+    static SyntheticWorld world;
+    return world;
+}
+
+RE::AlchemyItem* Bench::SyntheticWorld::MakeItem_(const std::string& a_editorID) {
+    auto item = std::make_unique<RE::AlchemyItem>(next_formid_++, RE::FormType::AlchemyItem);
+    item->SetFormEditorID(a_editorID.c_str());
+    item->fullName = a_editorID;
+    const auto raw = item.get();
+    RE::TESForm::Register(raw);
+    forms_.push_back(std::move(item));
+    return raw;
+}
+
+std::unique_ptr<Source> Bench::SyntheticWorld::MakeSource(const StageNo n_stages, const float stage_hours) {
+    const auto prefix = std::format("BenchSource{:x}_", next_formid_);
+
+    DefaultSettings settings;
+    for (StageNo no = 0; no < n_stages; ++no) {
+        settings.items[no] = MakeItem_(prefix + std::to_string(no))->GetFormID();
+        settings.durations[no] = stage_hours;
+        settings.stage_names[no] = std::format("Stage {}", no);
+        settings.crafting_allowed[no] = false;
+        settings.effects[no] = {};
+        settings.numbers.push_back(no);
+    }
+    settings.decayed_id = MakeItem_(prefix + "Decayed")->GetFormID();
+
+    auto source = std::make_unique<Source>(settings.items[0], "", &settings);
+    if (!source->IsHealthy()) {
+        throw std::runtime_error("synthetic source failed to initialise");
+    }
+    return source;
+}
+
+std::vector<RefID> Bench::Populate(Source& a_source, const size_t n_instances, const size_t per_location,
+                                   const float spread, const uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> start(0.f, spread);
+    std::uniform_int_distribution count(1, 5);
+
+    std::vector<RefID> locations;
+    for (size_t i = 0; i < n_instances; ++i) {
+        if (i % per_location == 0) locations.push_back(first_location + static_cast<RefID>(locations.size()));
+        a_source.InitInsertInstanceWO(0, count(rng), locations.back(), start(rng));
+    }
+    return locations;
+}
+
+void Bench::SetHoursPassed(const float a_hours) {
+    RE::Calendar::GetSingleton()->hoursPassed = a_hours;
+}
@@ -0,0 +1,82 @@
+// CoalesceTransfers on a frame's worth of hook transfers: items shuffled back and forth between the player and a few
+// containers (A->B, B->A, ...), several forms each, plus pickups from and drops to nowhere. Before timing, every
+// sequence is checked to leave the net count of each (reference, form) unchanged.
+#include "Bench.h"
+#include "TransferBatch.h"
+
+namespace {
+    constexpr RefID first_container = 0x00200000;
+    constexpr FormID first_item = 0x00300000;
+
+    // range(0) transfers over range(1) containers and the player, four forms
+    std::vector<ItemTransfer> MakeTransfers(const size_t n, const size_t n_containers, const uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<size_t> container(0, n_containers - 1);
+        std::uniform_int_distribution<FormID> item(0, 3);
+        std::uniform_int_distribution<Count> count(1, 5);
+        std::uniform_int_distribution kind(0, 9);
+        std::vector<ItemTransfer> transfers;
+        transfers.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            const RefID other = first_container + static_cast<RefID>(container(rng));
+            const FormID what = first_item + item(rng);
+            switch (const auto k = kind(rng)) {
+                case 0:
+                    // picked up from the world: the source ref is only known by id
+                    transfers.push_back({0, player_refid, what, count(rng), other});
+                    break;
+                case 1:
+                    transfers.push_back({player_refid, 0, what, count(rng), 0});
+                    break;
+                default:
+                    transfers.push_back(k % 2 ? ItemTransfer{player_refid, other, what, count(rng), 0}
+                                              : ItemTransfer{other, player_refid, what, count(rng), 0});
+            }
+        }
+        return transfers;
+    }
+
+    using NetCounts = std::map<std::tuple<RefID, FormID, RefID>, Count>;
+
+    // count each reference gains of each form; the refs-by-id end of a pickup is tracked apart from the others
+    NetCounts Net(const std::vector<ItemTransfer>& transfers) {
+        NetCounts net;
+        for (const auto& [from, to, what, count, from_refid] : transfers) {
+            if (from) net[{from, what, 0}] -= count;
+            if (from_refid) net[{from_refid, what, 1}] -= count;
+            if (to) net[{to, what, 0}] += count;
+        }
+        std::erase_if(net, [](const auto& entry) { return entry.second == 0; });
+        return net;
+    }
+
+    void BM_CoalesceTransfers(benchmark::State& state) {
+        const auto n = static_cast<size_t>(state.range(0));
+        const auto n_containers = static_cast<size_t>(state.range(1));
+        for (uint32_t seed = 1; seed <= 64; ++seed) {
+            auto transfers = MakeTransfers(n, n_containers, seed);
+            const auto before = Net(transfers);
+            CoalesceTransfers(transfers);
+            if (Net(transfers) != before ||
+                std::ranges::any_of(transfers, [](const ItemTransfer& t) { return t.count <= 0; })) {
+                state.SkipWithError("coalescing changed a net count");
+                return;
+            }
+        }
+
+        const auto input = MakeTransfers(n, n_containers, 1);
+        std::vector<ItemTransfer> transfers;
+        size_t kept = 0;
+        for (auto _ : state) {
+            transfers = input;
+            CoalesceTransfers(transfers);
+            kept = transfers.size();
+            benchmark::DoNotOptimize(transfers.data());
+        }
+        state.counters["kept"] = static_cast<double>(kept);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+}
+
+BENCHMARK(BM_CoalesceTransfers)->ArgNames({"n", "containers"})->ArgsProduct({{16, 256, 4096}, {1, 4}})
+                               ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,144 @@
+// Exclude-list matching: the compiled WordMatcher against the includesWord loop Settings::IsInExclude ran before,
+// over lists of 10 to 10k words and a fixed batch of editor ID / display name pairs, about one in 20 excluded.
+#include "Bench.h"
+#include "WordMatcher.h"
+
+namespace {
+    // StringHelpers::includesWord from CLibUtilsQTR (not part of this tree): lowercase, line breaks to spaces,
+    // trim, pad with spaces, then one find per list entry.
+    // " " + trimmed s + " "
+    std::string Padded(const std::string_view s) {
+        constexpr std::string_view spaces = " \t\n\r\f\v";
+        std::string out;
+        const auto first = s.find_first_not_of(spaces);
+        const auto trimmed = first == std::string_view::npos
+                                 ? std::string_view{}
+                                 : s.substr(first, s.find_last_not_of(spaces) - first + 1);
+        out.reserve(trimmed.size() + 2);
+        out.append(1, ' ').append(trimmed).append(1, ' ');
+        return out;
+    }
+
+    bool includesWord(const std::string& input, const std::vector<std::string>& strings) {
+        std::string lowerInput = input;
+        std::ranges::transform(lowerInput, lowerInput.begin(), [](const unsigned char c) {
+            return c == '\n' || c == '\r' ? ' ' : static_cast<char>(std::tolower(c));
+        });
+        lowerInput = Padded(lowerInput);
+        for (const auto& str : strings) {
+            std::string lowerStr = Padded(str);
+            std::ranges::transform(lowerStr, lowerStr.begin(),
+                                   [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            if (lowerInput.find(lowerStr) != std::string::npos) return true;
+        }
+        return false;
+    }
+
+    struct Form {
+        std::string editorid;
+        std::string name;
+    };
+
+    struct Corpus {
+        std::vector<std::string> words;
+        std::vector<Form> forms;
+    };
+
+    std::string RandomWord(std::mt19937& rng) {
+        std::uniform_int_distribution length(4, 10);
+        std::uniform_int_distribution letter(0, 25);
+        std::string word(static_cast<size_t>(length(rng)), 'a');
+        for (auto& c : word) c = static_cast<char>('a' + letter(rng));
+        return word;
+    }
+
+    // n_words exclude entries (some of two words, some capitalised) and 1024 forms named from a common vocabulary;
+    // every 20th form carries one of the listed words.
+    Corpus MakeCorpus(const size_t n_words) {
+        std::mt19937 rng(7);
+        Corpus corpus;
+        for (size_t i = 0; i < n_words; ++i) {
+            auto word = RandomWord(rng);
+            if (i % 7 == 0) word.append(1, ' ').append(RandomWord(rng));
+            if (i % 3 == 0) word[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(word[0])));
+            corpus.words.push_back(std::move(word));
+        }
+
+        std::vector<std::string> vocabulary(256);
+        for (auto& word : vocabulary) word = RandomWord(rng);
+        std::uniform_int_distribution pick(size_t{0}, vocabulary.size() - 1);
+        std::uniform_int_distribution listed(size_t{0}, n_words - 1);
+        for (size_t i = 0; i < 1024; ++i) {
+            Form form;
+            form.name.append(vocabulary[pick(rng)]).append(1, ' ').append(vocabulary[pick(rng)]);
+            if (i % 20 == 0) form.name.append(1, ' ').append(corpus.words[listed(rng)]);
+            form.editorid = "BenchFood" + std::to_string(i) + vocabulary[pick(rng)];
+            corpus.forms.push_back(std::move(form));
+        }
+        return corpus;
+    }
+
+    WordMatcher Compile(const std::vector<std::string>& a_words) {
+        WordMatcher matcher;
+        for (uint32_t i = 0; i < a_words.size(); ++i) matcher.Add(a_words[i], i);
+        matcher.Build();
+        return matcher;
+    }
+
+    // what IsInExclude did per form before and after
+    bool LegacyExcluded(const std::vector<std::string>& a_words, const Form& a_form) {
+        if (!a_form.editorid.empty() && includesWord(a_form.editorid, a_words)) return true;
+        return includesWord(a_form.name, a_words);
+    }
+
+    bool MatcherExcluded(const WordMatcher& a_matcher, const Form& a_form) {
+        return a_matcher.Matches(a_form.editorid) || a_matcher.Matches(a_form.name);
+    }
+
+    void ListSizes(benchmark::internal::Benchmark* b) {
+        b->RangeMultiplier(10)->Range(10, 10'000)->Unit(benchmark::kMicrosecond);
+    }
+
+    // one iteration checks all 1024 forms
+    void BM_ExcludeWordMatcher(benchmark::State& state) {
+        const auto corpus = MakeCorpus(static_cast<size_t>(state.range(0)));
+        const auto matcher = Compile(corpus.words);
+        for (const auto& form : corpus.forms) {
+            if (MatcherExcluded(matcher, form) != LegacyExcluded(corpus.words, form)) {
+                state.SkipWithError("WordMatcher disagrees with includesWord");
+                return;
+            }
+        }
+        state.counters["states"] = static_cast<double>(matcher.StateCount());
+        Bench::AllocationMeter allocs(state);
+        for (auto _ : state) {
+            for (const auto& form : corpus.forms) {
+                benchmark::DoNotOptimize(MatcherExcluded(matcher, form));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * corpus.forms.size()));
+    }
+
+    void BM_ExcludeIncludesWord(benchmark::State& state) {
+        const auto corpus = MakeCorpus(static_cast<size_t>(state.range(0)));
+        Bench::AllocationMeter allocs(state);
+        for (auto _ : state) {
+            for (const auto& form : corpus.forms) {
+                benchmark::DoNotOptimize(LegacyExcluded(corpus.words, form));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * corpus.forms.size()));
+    }
+
+    // paid once per type on load and on every AddToExclude
+    void BM_ExcludeCompile(benchmark::State& state) {
+        const auto corpus = MakeCorpus(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Compile(corpus.words));
+        }
+    }
+}
+
+BENCHMARK(BM_ExcludeWordMatcher)->Apply(ListSizes);
+BENCHMARK(BM_ExcludeIncludesWord)->Apply(ListSizes);
+BENCHMARK(BM_ExcludeCompile)->Apply(ListSizes);
@@ -15,4 +15,11 @@ set(headers ${headers}
 	include/Lorebox.h
 	include/CellScan.h
 	include/Queue.h
+	include/RefStopSchedule.h
+	include/MPSCRing.h
+	include/ReadModel.h
+	include/Profiler.h
+	include/LockProfiler.h
+	include/PresetCache.h
+	include/WordMatcher.h
 )
\ No newline at end of file
@@ -12,4 +12,7 @@ set(sources ${sources}
 	src/Lorebox.cpp
 	src/CellScan.cpp
 	src/Queue.cpp
+	src/Profiler.cpp
+	src/LockProfiler.cpp
+	src/PresetCache.cpp
 )
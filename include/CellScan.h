@@ -12,9 +12,43 @@ public:
         RE::NiPoint3 pos{};
     };
 
+    struct Hit {
+        float d2{0.f};
+        const Entry* entry{nullptr};
+    };
+
+    // The modulators of one base, bucketed into a uniform grid with cells of Settings::search_radius, so a radius
+    // query only visits the cells overlapping its box. Small bases stay a flat list.
+    struct BaseIndex {
+        // up to this many entries a linear scan beats the hash lookups
+        static constexpr size_t linear_max = 16;
+
+        float cellSize{0.f};
+        // grouped by grid cell once built
+        std::vector<Entry> entries;
+        // entries' positions split per axis (same order), filled by Build for the distance kernel
+        std::vector<float> xs, ys, zs;
+        // packed cell coordinate -> [first, last) in entries; empty when not gridded
+        std::unordered_map<std::uint64_t, std::pair<std::uint32_t, std::uint32_t>> cells;
+
+        void Build(float a_cellSize);
+
+        // Entries within radius of origin (any distance if radius <= 0), nearest first.
+        void QueryNearest(const RE::NiPoint3& origin, float radius, std::vector<Hit>& out) const;
+
+    private:
+        // Appends the entries in [first, last) within r2 of origin. SSE (AVX2 when built for it), scalar tail.
+        void FilterRange_(const RE::NiPoint3& origin, float r2, std::uint32_t first, std::uint32_t last,
+                          std::vector<Hit>& out) const;
+        [[nodiscard]] std::int32_t CellCoord_(float v) const;
+        [[nodiscard]] static std::uint64_t PackCell_(std::int32_t x, std::int32_t y, std::int32_t z);
+    };
+
     struct Cache {
         std::uint64_t generation{0};
-        std::unordered_map<FormID, std::vector<Entry>> byBase;
+        // order-independent hash over (base, refid, position); equal fingerprints mean the same modulator layout
+        std::uint64_t fingerprint{0};
+        std::unordered_map<FormID, BaseIndex> byBase;
     };
 
     using CachePtr = std::shared_ptr<const Cache>;
@@ -23,6 +57,10 @@ public:
 
     void RequestRefresh(const std::vector<Request>& requests);
 
+    // A reference was added, moved or removed: the cell it was indexed in and the cell it is in now are rescanned
+    // on the next refresh.
+    void MarkRefDirty(RefID refid);
+
     [[nodiscard]] CachePtr GetCache() const;
 
 private:
@@ -52,13 +90,42 @@ private:
     static void CollectCellsToScan_(const std::vector<RefInfo>& refInfos,
                                     std::unordered_set<RE::TESObjectCELL*>& cellsToScan);
 
-    static void ScanCells_(const std::unordered_set<RE::TESObjectCELL*>& cellsToScan,
-                           const std::unordered_set<FormID>& basesOfInterest, Cache& outCache);
+    [[nodiscard]] static std::uint64_t FingerprintEntry_(FormID base, const Entry& e);
 
-    void Publish_(std::shared_ptr<Cache> next);
+    // (base, entry) of every ref of interest in one cell
+    using CellEntries = std::vector<std::pair<FormID, Entry>>;
+
+    static void ScanCell_(RE::TESObjectCELL* cell, const std::unordered_set<FormID>& basesOfInterest,
+                          CellEntries& out);
+
+    // Brings cellIndex_ up to date with the cells around the requests; true if any cell's entries changed
+    bool UpdateIndex_(const std::unordered_set<RE::TESObjectCELL*>& cells, const std::unordered_set<FormID>& bases);
+
+    void DropCell_(FormID cellID);
+
+    // false if next was stale and not published
+    bool Publish_(std::shared_ptr<Cache> next);
 
     mutable std::shared_mutex cacheMutex_{};
     CachePtr cache_{std::make_shared<Cache>()};
 
     std::atomic<std::uint64_t> requestedGeneration_{0};
+
+    // Persistent per-cell index; game thread only (RunScanTaskOnGameThread_).
+    // Cells are keyed by FormID so an unloaded cell's memory being reused cannot alias an indexed one.
+    std::unordered_map<FormID, CellEntries> cellIndex_;
+    // indexed ref -> cell it was found in, to find the old cell of a moved or deleted ref
+    std::unordered_map<RefID, FormID> refCell_;
+    // bases the index was scanned for; a superset of the current request's bases
+    std::unordered_set<FormID> indexedBases_;
+    // bases of the last published cache
+    std::unordered_set<FormID> publishedBases_;
+    // one clean cell is rescanned per refresh to catch changes no event reported (havok drift, enable/disable)
+    size_t rollingCursor_{0};
+    // set when a cache was published without going through the index
+    std::atomic<bool> forcePublish_{false};
+
+    std::mutex dirtyMutex_;
+    // [locks: dirtyMutex_]
+    std::unordered_set<RefID> dirtyRefs_;
 };
\ No newline at end of file
@@ -121,9 +121,9 @@ struct StageInstance {
 
     [[nodiscard]] RE::TESBoundObject* GetBound() const;;
 
-    [[nodiscard]] inline float GetElapsed(float curr_time) const;
+    [[nodiscard]] float GetElapsed(float curr_time) const;
 
-    [[nodiscard]] inline float GetDelaySlope() const;
+    [[nodiscard]] float GetDelaySlope() const;
 
     void SetNewStart(float start_t);
     void SetNewStart(float curr_time, float overshot);
@@ -179,6 +179,77 @@ struct StageUpdate {
     }
 };
 
+// Flat read-only projection of one StageInstance, filled under the Manager lock so readers never copy a Source.
+struct StageRow {
+    enum class Direction : std::uint8_t {
+        kFrozen,
+        kForward,
+        kBackward,
+        kTransform
+    };
+
+    RefID location = 0;
+    FormID source_formid = 0;
+    FormID form_id = 0;
+    StageNo no = 0;
+    StageNo max_no = 0;
+    Count count = 0;
+    float start_time = 0.f;
+    Duration duration = 0.f;
+    float slope = 1.f;
+    // as shown in the MCP instance table
+    float delay_magnitude = 1.f;
+    FormID delayer = 0;
+    // multiplier configured for the delayer, the current slope if it is not a delayer
+    float delayer_multiplier = 1.f;
+    // in-game hours; <= 0 if the instance does not update anymore
+    float next_update_time = 0.f;
+    // progress in the current stage (or transformation) is linear in time between stage updates:
+    // progress_origin at evaluated_at, changing by progress_rate per hour. See ProgressAt.
+    bool has_progress = false;
+    float progress_origin = 0.f;
+    float progress_rate = 0.f;
+    float evaluated_at = 0.f;
+    Direction direction = Direction::kFrozen;
+    // form the instance turns into next (next/previous stage, decayed or transformed form); 0 if none
+    FormID next_formid = 0;
+    // set if next_formid is a stage of the same source (next_no is valid)
+    bool next_is_stage = false;
+    StageNo next_no = 0;
+    bool is_fake = false;
+    bool is_transforming = false;
+    bool is_decayed = false;
+    StageName name;
+    StageName next_name;
+
+    // progress at curr_time in [0,1]; negative if unknown
+    [[nodiscard]] float ProgressAt(const float curr_time) const {
+        if (!has_progress) return -1.f;
+        return std::clamp(progress_origin + (curr_time - evaluated_at) * progress_rate, 0.f, 1.f);
+    }
+};
+
+// Stage catalog of a source without its instances (for the MCP stage browser).
+struct SourceSummary {
+    struct StageEntry {
+        StageNo no;
+        FormID formid;
+        StageName name;
+        Duration duration;
+        bool is_fake;
+        bool crafting_allowed;
+    };
+
+    FormID formid = 0;
+    std::vector<StageEntry> stages;
+    // no of the decayed entry is one past the last stage
+    StageEntry decayed{};
+    std::vector<FormID> containers;
+    // transformer -> (end item, duration)
+    std::vector<std::pair<FormID, std::pair<FormID, Duration>>> transformers;
+    std::vector<std::pair<FormID, float>> delayers;
+};
+
 struct AddOnSettings {
     std::unordered_set<FormID> containers;
 
@@ -363,6 +434,9 @@ struct RefStop {
 
     void Update(const RefStop& other);
 
+    // true when every feature with an id is applied and nothing is left to retry
+    [[nodiscard]] bool FeaturesApplied() const;
+
     RE::TESObjectREFR* GetRef() const {
         return ref_info.GetRef();
     }
@@ -3,12 +3,34 @@
 #include "Lorebox.h"
 #include "CLibUtilsQTR/FormReader.hpp"
 
+// Transformer and delayer near a world object, resolved ahead of its update for one stage of one source.
+struct WorldModulation {
+    FormID source = 0;
+    StageNo no = 0;
+    FormID transformer = 0;
+    FormID delayer = 0;
+};
+
+using WorldModulationMap = std::unordered_map<RefID, WorldModulation>;
+
 struct Source {
     using SourceData = std::unordered_map<RefID, std::vector<StageInstance>>;
     using StageDict = std::map<StageNo, Stage>;
 
+    // Instances of one stage form at one location (count > 0). total and has_fake leave decayed instances out.
+    struct StageSlots {
+        std::vector<uint32_t> slots;
+        Count total = 0;
+        bool has_fake = false;
+    };
+
+    using LocationStageIndex = std::unordered_map<FormID, StageSlots>;
+
     SourceData data;
 
+    // Guards data and the stage index while the Manager holds its structural lock shared (see Manager.h).
+    mutable std::shared_mutex mutex;
+
     FormID formid = 0;
     std::string editorid;
     std::string qFormType;
@@ -32,6 +54,10 @@ struct Source {
 
     std::vector<StageUpdate> UpdateAllStages(RefID a_refID, float time);
 
+    // Catches up every instance at an inventory location to curr_time in one pass per instance, re-picking the
+    // inventory modulator at each stage boundary. Emits at most one StageUpdate per instance (first -> last stage).
+    std::vector<StageUpdate> FastForwardInventory(const RefInfo& a_info, float curr_time, const InvMap& inv);
+
     // daha once yaratilmis bi stage olmasi gerekiyo
     bool IsStage(FormID some_formid) const;
 
@@ -39,6 +65,10 @@ struct Source {
 
     [[nodiscard]] inline bool IsFakeStage(StageNo no) const;
 
+    // True while a fake stage has no form yet: GetStage would create it and register it with the Manager, which
+    // the paths holding only this source's lock must not do.
+    [[nodiscard]] bool HasUnfetchedFakeStage() const;
+
     // assumes that the formid exists as a stage!
     [[nodiscard]] StageNo GetStageNo(FormID formid_) const;
 
@@ -66,7 +96,12 @@ struct Source {
 
     FormID inline GetModulatorInWorld(const RE::TESObjectREFR* wo, StageNo a_no) const;
     inline FormID GetTransformerInWorld(const RE::TESObjectREFR* wo, StageNo a_no) const;
-    void UpdateTimeModulationInWorld(RE::TESObjectREFR* wo, StageInstance& wo_inst, float _time) const;
+    // Transformers and delayers allowed at stage a_no, appended in priority order.
+    void CollectWorldCandidates(StageNo a_no, std::vector<FormID>& a_transformers,
+                                std::vector<FormID>& a_delayers) const;
+    // a_resolved, if given, replaces the nearby search when it was resolved for this source and stage.
+    void UpdateTimeModulationInWorld(RE::TESObjectREFR* wo, StageInstance& wo_inst, float _time,
+                                     const WorldModulation* a_resolved = nullptr) const;
 
     // always update before doing this
     void UpdateTimeModulationInInventory(const RefInfo& a_info, float time, const InvMap& inv);
@@ -78,6 +113,39 @@ struct Source {
     float GetNextUpdateTime(const StageInstance* st_inst);
     float GetNextUpdateTime(const StageInstance* st_inst) const;
 
+    // What the stage index records of an instance.
+    struct IndexedState {
+        FormID form_id = 0;
+        Count count = 0;
+        bool is_decayed = false;
+        bool is_fake = false;
+
+        bool operator==(const IndexedState&) const = default;
+    };
+
+    [[nodiscard]] static IndexedState IndexedStateOf(const StageInstance& st_inst) {
+        return {st_inst.xtra.form_id, st_inst.count, st_inst.xtra.is_decayed, st_inst.xtra.is_fake};
+    }
+
+    // Per-location index of data by stage form. Kept in sync incrementally by the Source methods that mutate data;
+    // whoever changes data[loc] directly must do the same with ReindexSlot / UnindexSlot.
+    [[nodiscard]] const LocationStageIndex* GetStageIndex(RefID loc) const;
+    [[nodiscard]] const StageSlots* FindStageSlots(RefID loc, FormID stage_formid) const;
+    // data[loc][slot] was changed in place; before is its IndexedStateOf from before the change.
+    void ReindexSlot(RefID loc, uint32_t slot, const IndexedState& before);
+    // data[loc][slot] is about to be erased; the later slots shift down by one.
+    void UnindexSlot(RefID loc, uint32_t slot);
+    // Same for every slot flagged in erased, which is as long as data[loc].
+    void UnindexSlots(RefID loc, const std::vector<char>& erased);
+    // Rebuilds the index of loc from scratch, or drops it if loc has no data. For load and validation.
+    void ReindexLocation(RefID loc);
+
+    // Read-only projection of an instance at location loc, evaluated at curr_time.
+    [[nodiscard]] StageRow ProjectRow(const StageInstance& st_inst, RefID loc, float curr_time) const;
+
+    // Stages and settings shown in the MCP, without the instance data.
+    [[nodiscard]] SourceSummary Summarize() const;
+
     void CleanUpData();
     void CleanUpData(RefID a_loc);
 
@@ -86,7 +154,7 @@ struct Source {
     void Reset();
 
     [[nodiscard]] bool IsHealthy() const {
-        return !init_failed;
+        return !init_failed.load(std::memory_order_acquire);
     }
 
     [[nodiscard]] const Stage& GetDecayedStage() const { return decayed_stage; }
@@ -104,15 +172,39 @@ private:
     std::unordered_map<FormID, Stage> transformed_stages;
 
     std::vector<StageInstance*> queued_time_modulator_updates;
-    bool init_failed = false;
+    // Atomic because CleanUpData can mark the source failed under only its own mutex, while the Manager checks
+    // IsHealthy() without it.
+    std::atomic<bool> init_failed = false;
 
     StageDict stages;
 
+    std::unordered_map<RefID, LocationStageIndex> stage_index;
+
+    static void IndexInstance(LocationStageIndex& index, const StageInstance& st_inst, uint32_t slot);
+    // Takes slot, which was recorded as state, out of index. instances are the location's, for has_fake.
+    static void UnindexInstance(LocationStageIndex& index, const IndexedState& state, uint32_t slot,
+                                const std::vector<StageInstance>& instances);
+
     // counta karismiyor
     [[nodiscard]] bool UpdateStageInstanceHelper(StageInstance& st_inst, float curr_time,
                                                  const std::unordered_set<StageNo>& a_allowed_delayer_stages);
     [[nodiscard]] bool UpdateStageInstance(StageInstance& st_inst, float curr_time);
 
+    // Updates the instance and resolves the stage it ends up in (decayed/transformed included).
+    // Returns nullptr if nothing changed.
+    const Stage* AdvanceInstance(StageInstance& instance, float time);
+
+    // Merges instances that are AlmostSameExceptCount, sorting them first so each is only compared with those that
+    // started within the tolerance after it; merged-away ones are left with count 0.
+    static void MergeAlmostSame(std::vector<StageInstance>& instances, float curr_time);
+
+    // Merges, drops dead/forgotten instances and invalid modulators of loc, keeping its stage index in step.
+    // Returns the number removed.
+    uint32_t CleanUpInstances(RefID loc, std::vector<StageInstance>& instances, float curr_time);
+
+    // guards against slopes flipping back and forth forever
+    static constexpr size_t max_catch_up_boundaries = 256;
+
     template <typename T>
     void ApplyMGEFFSettings(T* stage_form, std::vector<StageEffect>& settings_effs) {
         RE::BSTArray<RE::Effect*> _effects = FormTraits<T>::GetEffects(stage_form);
@@ -190,6 +282,10 @@ private:
     StageNo GetLastStageNo();
 
     static FormID SearchNearbyModulatorsCached(const RE::TESObjectREFR* a_obj, const std::vector<FormID>& candidates);
+    // SearchNearbyModulatorsCached for many objects against one cache snapshot: fills a_out[i] for every objs[i]
+    // that is not null and has no result yet. objs and a_out must have the same size.
+    static void SearchNearbyModulatorsBatch(const std::vector<FormID>& candidates,
+                                            std::span<const RE::TESObjectREFR* const> objs, std::span<FormID> a_out);
 };
 
 template <typename T>
@@ -8,7 +8,8 @@ class EventSink final : public REX::Singleton<EventSink>,
                         public RE::BSTEventSink<RE::TESSleepStopEvent>,
                         public RE::BSTEventSink<RE::TESWaitStopEvent>,
                         public RE::BSTEventSink<RE::BGSActorCellEvent>,
-                        public RE::BSTEventSink<RE::TESFormDeleteEvent> {
+                        public RE::BSTEventSink<RE::TESFormDeleteEvent>,
+                        public RE::BSTEventSink<RE::TESMoveAttachDetachEvent> {
     bool furniture_entered = false;
     RE::NiPointer<RE::TESObjectREFR> furniture = nullptr;
 
@@ -39,4 +40,8 @@ public:
 
     RE::BSEventNotifyControl ProcessEvent(const RE::TESFormDeleteEvent* a_event,
                                           RE::BSTEventSource<RE::TESFormDeleteEvent>*) override;
+
+    // keeps the CellScanner's per-cell index current
+    RE::BSEventNotifyControl ProcessEvent(const RE::TESMoveAttachDetachEvent* a_event,
+                                          RE::BSTEventSource<RE::TESMoveAttachDetachEvent>*) override;
 };
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+
+// Opt-in contention profiling of the Manager locks in release builds (configure with -DENABLE_AOT_LOCK_PROFILING=ON).
+// Every SRC_*/QUE_* guard expansion gets its own Site with log2 histograms of the time spent waiting for the mutex
+// and the time it was held. All updates are relaxed atomics; sites are never freed.
+namespace LockProfiler {
+    // bucket b holds durations in [2^(b-1), 2^b) ns; the last one is open ended
+    inline constexpr size_t n_buckets = 40;
+
+    struct Histogram {
+        std::array<std::atomic<uint64_t>, n_buckets> buckets{};
+
+        void Add(uint64_t ns);
+        void Reset();
+        // upper bound of the bucket holding quantile q (0..1), 0 if empty
+        [[nodiscard]] uint64_t Quantile(double q) const;
+    };
+
+    struct Site {
+        const char* mutex;
+        const char* func;
+        const char* file;
+        int line;
+        bool unique;
+
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> total_wait_ns{0};
+        std::atomic<uint64_t> total_hold_ns{0};
+        std::atomic<uint64_t> max_wait_ns{0};
+        std::atomic<uint64_t> max_hold_ns{0};
+        Histogram wait;
+        Histogram hold;
+        Site* next = nullptr;
+
+        Site(const char* a_mutex, bool a_unique, const char* a_file, int a_line, const char* a_func);
+
+        void RecordWait(uint64_t ns);
+        void RecordHold(uint64_t ns);
+        void Reset();
+    };
+
+    struct Stats {
+        const char* mutex;
+        const char* func;
+        int line;
+        bool unique;
+        uint64_t calls;
+        uint64_t total_wait_ns;
+        uint64_t p99_wait_ns;
+        uint64_t max_wait_ns;
+        double avg_hold_ns;
+        uint64_t p99_hold_ns;
+        uint64_t max_hold_ns;
+    };
+
+    // Sites with at least one acquisition, most total wait first.
+    std::vector<Stats> Snapshot(size_t max_sites);
+
+    void ResetAll();
+
+    [[nodiscard]] constexpr bool Enabled() {
+#ifdef AOT_LOCK_PROFILING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Drop-in for std::shared_lock / std::unique_lock on a std::shared_mutex that reports to a Site.
+    template <bool Unique>
+    class ProfiledLock {
+    public:
+        ProfiledLock(std::shared_mutex& a_mutex, Site& a_site) : mutex_(a_mutex), site_(a_site) {
+            const auto t0 = std::chrono::steady_clock::now();
+            if constexpr (Unique) {
+                mutex_.lock();
+            } else {
+                mutex_.lock_shared();
+            }
+            acquired_ = std::chrono::steady_clock::now();
+            site_.RecordWait(Elapsed(t0, acquired_));
+        }
+
+        ~ProfiledLock() {
+            site_.RecordHold(Elapsed(acquired_, std::chrono::steady_clock::now()));
+            if constexpr (Unique) {
+                mutex_.unlock();
+            } else {
+                mutex_.unlock_shared();
+            }
+        }
+
+        ProfiledLock(const ProfiledLock&) = delete;
+        ProfiledLock& operator=(const ProfiledLock&) = delete;
+
+    private:
+        static uint64_t Elapsed(const std::chrono::steady_clock::time_point a,
+                                const std::chrono::steady_clock::time_point b) {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count());
+        }
+
+        std::shared_mutex& mutex_;
+        Site& site_;
+        std::chrono::steady_clock::time_point acquired_;
+    };
+}
@@ -82,6 +82,7 @@ namespace UI {
     inline ImGuiMCP::ImGuiTextFilter* filter2;
     inline std::string filter_module = "None";
     inline int selected_source_index = 0;
+    inline constexpr size_t refresh_page_size = 512;
     inline ImGuiMCP::ImGuiTableFlags table_flags =
         ImGuiMCP::ImGuiTableFlags_Resizable | ImGuiMCP::ImGuiTableFlags_SizingFixedFit |
         ImGuiMCP::ImGuiTableFlags_SizingStretchProp | ImGuiMCP::ImGuiTableFlags_Borders |
@@ -104,6 +105,12 @@ namespace UI {
     inline bool lorebox_show_title = true;
     inline bool lorebox_show_percentage = true;
 
+    void InstanceMemory();
+    void DirtyRefUpdates();
+    // only shown in builds configured with ENABLE_AOT_PROFILING
+    void HotPathTimings();
+    // only shown in builds configured with ENABLE_AOT_LOCK_PROFILING
+    void LockContention();
     void ExcludeList();
     void IniSettingToggle(bool& setting, const std::string& setting_name, const std::string& section_name,
                           const char* desc);
@@ -111,8 +118,9 @@ namespace UI {
     void DrawFilter2();
     bool DrawFilterModule();
     void UpdateSubItem();
-    void UpdateLocationMap(const std::vector<Source>& sources);
-    void UpdateStages(const std::vector<Source>& sources);
+    // Appends a page of projected instance rows to locations.
+    void UpdateLocationMap(const std::vector<StageRow>& rows);
+    void UpdateStages(const std::vector<SourceSummary>& summaries);
     void RefreshButton();
     void Refresh();
 
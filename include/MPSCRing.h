@@ -0,0 +1,68 @@
+#pragma once
+
+// Bounded lock-free multi-producer single-consumer ring, after Vyukov's sequence-numbered cells.
+// TryPush costs one CAS on the tail plus one release store; it fails instead of blocking when the ring is full.
+// TryPop must only be called by one thread at a time (the owner serialises consumers).
+template <typename T, size_t Capacity>
+class MPSCRing {
+    static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+    MPSCRing() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPSCRing(const MPSCRing&) = delete;
+    MPSCRing& operator=(const MPSCRing&) = delete;
+
+    bool TryPush(const T& value) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = cells_[pos & mask];
+            const size_t seq = cell.seq.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // the consumer has not freed this cell yet
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Stops at the first cell a producer has claimed but not finished writing; it is picked up next time.
+    bool TryPop(T& a_out) {
+        auto& cell = cells_[head_ & mask];
+        const size_t seq = cell.seq.load(std::memory_order_acquire);
+        if (static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(head_ + 1) < 0) {
+            return false;
+        }
+        a_out = cell.value;
+        cell.seq.store(head_ + Capacity, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    static constexpr size_t capacity = Capacity;
+
+private:
+    struct Cell {
+        std::atomic<size_t> seq;
+        T value;
+    };
+
+    static constexpr size_t mask = Capacity - 1;
+
+    std::array<Cell, Capacity> cells_{};
+    alignas(64) std::atomic<size_t> tail_{0};
+    alignas(64) size_t head_ = 0;
+};
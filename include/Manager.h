@@ -1,12 +1,48 @@
 #pragma once
 #include "Data.h"
+#include "ReadModel.h"
+#include "RefStopSchedule.h"
 #include "ClibUtilsQTR/Ticker.hpp"
 
 class QueueManager;
 
 class Manager final : public Ticker, public SaveLoadData {
+public:
+    struct MemoryReport {
+        size_t n_instances = 0;
+        size_t n_locations = 0;
+        size_t bytes_per_instance = 0;
+        // same instances with the editor ID stored inline as std::string (heap included)
+        size_t legacy_bytes_per_instance = 0;
+        size_t n_editor_ids = 0;
+        size_t editor_id_pool_bytes = 0;
+    };
+
+private:
+    struct DirtyRef {
+        RE::ObjectRefHandle handle;
+        // ProcessDirtyRefs_ frame it was marked in; refs gain priority as they wait
+        uint64_t marked_frame;
+    };
+
     std::shared_mutex dirty_mtx_;
-    std::unordered_map<RefID, RE::ObjectRefHandle> dirty_refs_;
+    std::unordered_map<RefID, DirtyRef> dirty_refs_;
+    // (marked_frame, refid) of every entry of dirty_refs_, longest waiting first
+    std::set<std::pair<uint64_t, RefID>> dirty_order_;
+    std::atomic<uint64_t> dirty_frame_{0};
+    // last crosshair target, updated by the crosshair event sink
+    std::atomic<RefID> crosshair_ref_{0};
+
+    std::mutex dirty_stats_mtx_;
+    // [locks: dirty_stats_mtx_] microseconds spent by the last frames, for the percentile
+    std::array<uint32_t, 256> dirty_frame_us_{};
+    // [locks: dirty_stats_mtx_]
+    uint64_t dirty_frames_ = 0;
+    uint64_t dirty_refs_done_ = 0;
+    uint64_t dirty_over_budget_ = 0;
+    uint64_t dirty_total_us_ = 0;
+    uint64_t dirty_max_us_ = 0;
+    size_t dirty_backlog_ = 0;
     std::atomic<int32_t> n_instances_{0};
 
     void MarkDirty_(RE::TESObjectREFR* r);
@@ -65,15 +101,24 @@ class Manager final : public Ticker, public SaveLoadData {
 
     // 0x0003eb42 damage health
 
-    // LOCKING CONVENTION (debug assertions enforce this in Manager.cpp):
-    // Acquire sourceMutex_ before queueMutex_ when both are needed.
-    // It is legal to lock queueMutex_ while holding sourceMutex_.
+    // LOCKING CONVENTION (debug assertions enforce the sourceMutex_/queueMutex_ part in Manager.cpp):
+    // sourceMutex_ is the structural lock for sources, stage_to_sources and the Source objects themselves.
+    //   unique: exclusive mode. Every Source may be read and mutated without taking its own mutex.
+    //   shared: the set of sources is frozen. A Source's data and stage index may only be touched under that
+    //           Source's mutex (Source::mutex, DATA_SHARED_GUARD / DATA_UNIQUE_GUARD), one Source at a time.
+    // Lock order: sourceMutex_ -> readModelMutex_ -> one Source::mutex -> queueMutex_ -> registryMutex_.
     // It is ILLEGAL to acquire sourceMutex_ while any shared/unique lock on queueMutex_ is held (deadlock prevention).
     // No re-entrancy: the same thread must not take the same mutex twice (shared or unique) and no upgrade/downgrade.
     // Methods are annotated with [expects: ...] or [locks: ...] to indicate required / performed locking.
-    // Use SRC_SHARED_GUARD / SRC_UNIQUE_GUARD then QUE_SHARED_GUARD / QUE_UNIQUE_GUARD in that order.
+    // "[expects: sourceMutex_] (unique)" on a helper that only touches one Source also admits sourceMutex_ (shared)
+    // plus that Source's mutex (unique); the confined fast paths of UpdateImpl and UpdateQueuedWO rely on this.
+    // readModelMutex_ is only taken by PublishReadModel_.
+    // registryMutex_ is a leaf guarding loc_to_sources, do_not_register and the read model dirty marks. Writers
+    // always take it; readers take it unless they hold sourceMutex_ (unique).
     std::shared_mutex sourceMutex_;
     std::shared_mutex queueMutex_;
+    std::mutex readModelMutex_;
+    std::mutex registryMutex_;
 
     std::unordered_map<FormID, std::unique_ptr<Source>> sources;
     // maps stage formid to source formids
@@ -88,11 +133,94 @@ class Manager final : public Ticker, public SaveLoadData {
     // queueMutex_ guards these
     std::unordered_map<RefID, RefStop> _ref_stops_;
     std::unordered_set<RefID> queue_delete_;
+    // stop_time index over _ref_stops_; every insert/erase of _ref_stops_ must be mirrored here
+    RefStopSchedule stop_schedule_;
+    // refstops whose visual features could not be applied yet (e.g. 3D not loaded, or not near the player)
+    std::unordered_set<RefID> pending_features_;
+
+    // Level of detail of a queued world object, by its distance to the player. Near objects get their visual
+    // features and exact stop times. The others are scheduled on a coarser grid of game hours, so far objects
+    // catch up together in fewer ticks, and their features wait until they come near.
+    enum class WOTier : uint8_t {
+        kNear,
+        kMid,
+        kFar
+    };
+
+    struct WOPlace {
+        RE::NiPoint3 pos;
+        // interior cell, or worldspace of an exterior cell
+        FormID space = 0;
+    };
+
+    // Taken whenever the refstop is queued or rescheduled, and when the object is moved (RetierWO).
+    struct WOLod {
+        WOPlace place;
+        WOTier tier = WOTier::kNear;
+    };
+
+    // refstops with a known place; absent means near
+    std::unordered_map<RefID, WOLod> wo_lods_;
+    // player place the tiers were last computed against
+    std::optional<WOPlace> lod_player_place_;
+    // bumped whenever the set of refstops (or their stop times) changes
+    uint64_t refstops_version_ = 0;
+
+    // ticker thread only
+    std::vector<std::pair<RefInfo, std::vector<FormID>>> scan_requests_;
+    uint64_t scan_requests_version_ = std::numeric_limits<uint64_t>::max();
+    uint64_t modulator_fingerprint_ = 0;
 
     std::unordered_set<FormID> do_not_register;
 
+    // Read model bookkeeping. Writers record changes under registryMutex_; the publisher drains them under
+    // sourceMutex_ (shared) + readModelMutex_.
+    std::unordered_set<RefID> read_model_dirty_;
+    bool read_model_all_dirty_ = true;
+    bool read_model_sources_dirty_ = true;
+    // set with any mark, cleared when the publisher takes them; lets PublishReadModel skip its locks
+    std::atomic<bool> read_model_pending_{true};
+    std::atomic<std::shared_ptr<const ReadModel>> read_model_{std::make_shared<const ReadModel>()};
+
+    // [locks: registryMutex_]
+    void MarkReadModelDirty_(RefID loc);
+    // [locks: registryMutex_]
+    void MarkReadModelAllDirty_();
+    // [locks: registryMutex_]
+    void MarkReadModelSourcesDirty_();
+
+    // Builds and publishes a new read model from what changed since the last one. No-op if nothing did.
+    // [expects: sourceMutex_] (shared) [locks: readModelMutex_, Source::mutex (shared), registryMutex_]
+    void PublishReadModel_();
+
+    // Called once per frame (end of ProcessDirtyRefs_) and once per ticker tick, plus after the rare whole-state
+    // changes (load, save, reset); mutations in between only mark. No lock held. [locks: sourceMutex_] (shared)
+    void PublishReadModel();
+
+    // [expects: sourceMutex_] (shared) [locks: Source::mutex (shared), registryMutex_]
+    ReadModel::LocationView BuildLocationView_(RefID loc, float curr_time);
+
+    static std::vector<FormID> CollectScanBases_(const Source& src, StageNo no);
+
     static void PreDeleteRefStop(RefStop& a_ref_stop);
 
+    // Removes a refstop from _ref_stops_ and the schedule. [expects: queueMutex_] (unique)
+    void EraseRefStop_(RefID refid);
+
+    [[nodiscard]] static std::optional<WOPlace> PlaceOf_(const RE::TESObjectREFR* ref);
+    // near if the player place is unknown, far if in another cell or worldspace
+    [[nodiscard]] static WOTier TierOf_(const WOPlace& place, const std::optional<WOPlace>& player);
+    // stop_time snapped up to the grid of the tier
+    [[nodiscard]] static float TierStopTime_(WOTier tier, float stop_time);
+    // Records where refid is and its tier there. Without a place (no parent cell) the last known one stays.
+    // [expects: queueMutex_] (unique)
+    void SetWOPlace_(RefID refid, const std::optional<WOPlace>& place);
+    // Schedules refid at stop_time, or later per its tier. [expects: queueMutex_] (unique)
+    void ScheduleStop_(RefID refid, float stop_time);
+    // Once the player has moved Settings::lod_retier_distance or changed cell or worldspace since the last call
+    // that did work, re-tiers the refstops and reschedules those whose tier changed. [locks: queueMutex_]
+    void RetierWOs_();
+
     // Ticker thread entry. [locks: queueMutex_]
     void UpdateLoop();
 
@@ -109,9 +237,19 @@ class Manager final : public Ticker, public SaveLoadData {
 
     void IndexSourceStages(const Source& source);
 
+    // [locks: registryMutex_]
     void AddLocationIndex(RefID location_id, FormID source_formid);
+    // [locks: registryMutex_]
     void RemoveLocationIndex(RefID location_id, FormID source_formid);
-    void UpdateLocationIndexForSource(const Source& src, RefID location_id);
+    // Source formids indexed at location_id. [locks: registryMutex_]
+    [[nodiscard]] std::vector<FormID> GetLocationSources_(RefID location_id);
+
+    // [locks: registryMutex_]
+    [[nodiscard]] bool IsDoNotRegister_(FormID some_formid);
+    // [locks: registryMutex_]
+    void AddDoNotRegister_(FormID some_formid);
+    // The Source keeps its stage index in step itself; this only drops it if location_id has no data left.
+    void UpdateLocationIndexForSource(Source& src, RefID location_id);
     void RefreshLocationIndex(RefID location_id);
 
     // Cleans up a Source instance. [expects: sourceMutex_] (unique)
@@ -120,7 +258,7 @@ class Manager final : public Ticker, public SaveLoadData {
 
     // Lookup by form id among existing sources. [expects: sourceMutex_] (shared)
     [[nodiscard]] Source* GetSource(FormID some_formid);
-    // Lookup by ref id among existing sources. [expects: sourceMutex_] (shared)
+    // Lookup by ref id among existing sources. Reads the data of several sources. [expects: sourceMutex_] (unique)
     [[nodiscard]] Source* GetSourceByLocation(RefID location_id);
 
     // Get or create a Source; may mutate the sources list. [expects: sourceMutex_] (unique)
@@ -129,7 +267,7 @@ class Manager final : public Ticker, public SaveLoadData {
     static bool IsSource(FormID some_formid);
 
     // Returns pointer into Source::data; pointer valid only while sourceMutex_ remains held. 
-    // [expects: sourceMutex_] (shared)
+    // [expects: sourceMutex_] (unique)
     [[nodiscard]] StageInstance* GetWOStageInstance(const RE::TESObjectREFR* wo_ref);
 
     static inline void ApplyStageInWorld_Fake(RE::TESObjectREFR* wo_ref, const char* xname);
@@ -157,7 +295,35 @@ class Manager final : public Ticker, public SaveLoadData {
     // [expects: sourceMutex_] (unique)
     void UpdateInventory(const RefInfo& a_info, const InvMap& inv);
 
-    void UpdateQueuedWO(const RefInfo& ref_info, float curr_time);
+    // Closed-form catch-up of an inventory to curr_time; see Source::FastForwardInventory.
+    // [expects: sourceMutex_] (unique)
+    void FastForwardInventory(const RefInfo& a_info, float curr_time, const InvMap& inv);
+
+    // World object registrations left for after the Source lock of a confined update is released.
+    struct WORegistration {
+        FormID formid;
+        Count count;
+        RefID refid;
+        Duration time;
+    };
+
+    // Modulators of the queued world objects of one tick. Objects are grouped by their candidate bases and each
+    // group is joined against the CellScanner cache once. [locks: sourceMutex_ (shared), registryMutex_,
+    // Source::mutex (shared)]
+    [[nodiscard]] WorldModulationMap ResolveWOModulations_(const std::vector<RefInfo>& to_update);
+
+    // a_modulation: this object's entry from ResolveWOModulations_, if any.
+    // [locks: sourceMutex_] (shared, then unique if needed)
+    void UpdateQueuedWO(const RefInfo& ref_info, float curr_time, const WorldModulation* a_modulation = nullptr);
+    // Source of a world object whose update stays inside that one Source: a single live instance whose base
+    // matches its stage, and no fake stage left to create. nullptr if the update needs exclusive mode.
+    // [expects: sourceMutex_] (shared)
+    // [locks: registryMutex_, Source::mutex (shared)]
+    Source* GetConfinedWOSource_(RE::TESObjectREFR* ref);
+    // Evolves a world object tracked by src. Registrations into other sources are appended to a_deferred.
+    // [expects: sourceMutex_] (unique), or sourceMutex_ (shared) + src.mutex (unique)
+    void EvolveWO_(Source& src, RE::TESObjectREFR* ref, float curr_time, std::vector<WORegistration>& a_deferred,
+                   const WorldModulation* a_modulation = nullptr);
     // [expects: sourceMutex_] (unique)
     void UpdateWO(RE::TESObjectREFR* ref);
     // [expects: sourceMutex_] (unique)
@@ -176,16 +342,25 @@ class Manager final : public Ticker, public SaveLoadData {
 
     using ScanRequest = std::pair<RefInfo, std::vector<FormID>>;
 
+    // Reads the published read model; takes no lock.
     [[nodiscard]] std::vector<ScanRequest> BuildCellScanRequests_(
-        const std::vector<RefInfo>& refStopsCopy);
+        const std::vector<RefInfo>& refStopsCopy) const;
 
-    static bool LocHasStage(Source* src, RefID loc, FormID stage_formid);
+    static bool LocHasStage(const Source* src, RefID loc, FormID stage_formid);
 
     // best-effort disambiguation: owner-ref first, then stage-only
+    // [expects: sourceMutex_] (shared) [locks: registryMutex_, Source::mutex (shared)]
     Source* UpdateGetSource(FormID stage_formid, RefID owner_refid);
 
+    // True if moving ctx.what into ctx.to only touches src, so src.mutex suffices. [expects: sourceMutex_] (shared)
+    // [locks: Source::mutex (shared)]
+    bool IsConfinedTransfer_(const Source& src, const UpdateCtx& ctx);
+
     std::optional<float> GetNextUpdateTime(const RefInfo& a_info);
 
+    // [expects: sourceMutex_] (shared) [locks: Source::mutex (shared)]
+    MemoryReport GetMemoryReport_() const;
+
 protected:
     void UpdateImpl(RE::TESObjectREFR* from, RE::TESObjectREFR* to, const RE::TESForm* what, Count count,
                     RefID from_refid, bool refreshRefs);
@@ -229,7 +404,7 @@ public:
 
     void UpdateNow(RE::TESObjectREFR* a_ref);
 
-    // Swap based on stage instance. Holds sourceMutex_ internally. (shared)
+    // Swap based on stage instance. Holds sourceMutex_ internally. (unique)
     void SwapWithStage(RE::TESObjectREFR* wo_ref);
 
     // Clears and resets all data. [locks: sourceMutex_] (unique) + [locks: queueMutex_]
@@ -253,20 +428,37 @@ public:
 
     void Print();
 
-    // Snapshot copy of sources (read-only). [locks: sourceMutex_] (shared)
-    std::vector<Source> GetSources();
+    // Latest published read model; never null. Lock-free, see ReadModel.
+    [[nodiscard]] std::shared_ptr<const ReadModel> GetReadModel() const {
+        return read_model_.load(std::memory_order_acquire);
+    }
+
+    // The queries below read the published read model and take no lock.
 
-    // Snapshot copy of sources matching a stage form and location. [locks: sourceMutex_] (shared)
-    std::vector<Source> GetSourcesByStageAndOwner(FormID stage_formid, RefID location_id);
+    // Rows of the live (count > 0, not decayed) instances of stage_formid at location_id.
+    // a_out is cleared first so callers can reuse its capacity.
+    void QueryStageRows(FormID stage_formid, RefID location_id, std::vector<StageRow>& a_out) const;
+
+    // At most a_limit rows starting at a_offset, over all instances of all sources in a_model.
+    // Returns the total number of instances. Offsets are only stable within one model, so keep the
+    // one from GetReadModel() for every page of a scan.
+    static size_t QueryInstancePage(const ReadModel& a_model, size_t a_offset, size_t a_limit,
+                                    std::vector<StageRow>& a_out);
+
+    // Stage catalogs of the healthy sources; never null.
+    [[nodiscard]] std::shared_ptr<const std::vector<SourceSummary>> GetSourceSummaries() const;
+
+    // [locks: sourceMutex_] (shared), Source::mutex (shared)
+    MemoryReport GetMemoryReport();
 
     // Snapshot of the update queue. [locks: queueMutex_] (shared)
     std::unordered_map<RefID, float> GetUpdateQueue();
 
-    // [expects: sourceMutex_] (shared)
+    // [expects: sourceMutex_] (unique)
     void HandleDynamicWO(RE::TESObjectREFR* ref);
 
     // Note: called from contexts that already hold sourceMutex_. Do not acquire it inside. 
-    // [expects: sourceMutex_] (shared)
+    // [expects: sourceMutex_] (unique)
     void HandleWOBaseChange(RE::TESObjectREFR* ref);
 
     bool IsTickerActive() const {
@@ -277,8 +469,35 @@ public:
 
     void IndexStage(FormID stage_formid, FormID source_formid);
 
+    // Updates dirty refs, most urgent first, until Settings::dirty_update_budget_us is spent (at least one per call)
+    // or Settings::max_dirty_updates were done. The player, the open container and the crosshair target go first;
+    // the rest by how many frames they have waited. Called every frame from the menu and player update hooks, and
+    // publishes the read model for everything marked during the frame.
     void ProcessDirtyRefs_();
 
+    void SetCrosshairRef(RefID refid) { crosshair_ref_.store(refid, std::memory_order_relaxed); }
+
+    // Re-takes the place and tier of a queued world object that was moved, and reschedules it on the grid of its
+    // new tier. No-op for refs without a refstop. [locks: queueMutex_]
+    void RetierWO(const RE::TESObjectREFR* ref);
+
+    struct DirtyRefStats {
+        // frames that had dirty refs
+        uint64_t frames = 0;
+        uint64_t refs = 0;
+        // frames that ran out of budget and left refs for the next one
+        uint64_t over_budget = 0;
+        double avg_us = 0;
+        uint64_t p99_us = 0;
+        uint64_t max_us = 0;
+        size_t backlog = 0;
+    };
+
+    // [locks: dirty_stats_mtx_]
+    DirtyRefStats GetDirtyRefStats();
+    // [locks: dirty_stats_mtx_]
+    void ResetDirtyRefStats();
+
     void InstanceCountUpdate(int32_t delta);
 };
 
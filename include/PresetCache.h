@@ -0,0 +1,96 @@
+#pragma once
+#include "CustomObjects.h"
+
+// Binary cache of the parsed preset YAML (defaults, custom and addon files of every QFORM type).
+// One entry per source file, keyed by its path and stamped with size, mtime and a content hash. Only files whose
+// stamp changed are parsed again. The whole cache is dropped when the load order (or the size or mtime of any
+// plugin in it), the formGroups folder or the plugin version changes, since parsed FormIDs depend on them.
+// The payloads are encoded by PresetCodec.
+// The previous cache stays memory-mapped while settings load and is replaced by Save().
+// Find/Store are safe to call from the settings loader tasks concurrently.
+class PresetCache {
+public:
+    struct FileStamp {
+        std::uint64_t size = 0;
+        std::int64_t mtime = 0;
+        std::uint64_t hash = 0;
+    };
+
+    struct SourceFile {
+        std::string content;
+        FileStamp stamp;
+    };
+
+    using AddOnMap = std::unordered_map<FormID, AddOnSettings>;
+
+    inline static const std::string cache_path = std::format("Data/SKSE/Plugins/{}/PresetCache.bin",
+                                                             Utils::mod_name);
+
+    // Reads a preset file and stamps it. nullopt if it cannot be opened.
+    static std::optional<SourceFile> ReadSource(const std::string& filename);
+
+    PresetCache();
+    ~PresetCache();
+
+    PresetCache(const PresetCache&) = delete;
+    PresetCache& operator=(const PresetCache&) = delete;
+
+    // true and a_out filled if filename was cached with the same content
+    bool Find(const std::string& filename, const FileStamp& stamp, DefaultSettings& a_out);
+    bool Find(const std::string& filename, const FileStamp& stamp, CustomSettings& a_out);
+    bool Find(const std::string& filename, const FileStamp& stamp, AddOnMap& a_out);
+
+    void Store(const std::string& filename, const FileStamp& stamp, const DefaultSettings& settings);
+    void Store(const std::string& filename, const FileStamp& stamp, const CustomSettings& settings);
+    void Store(const std::string& filename, const FileStamp& stamp, const AddOnMap& settings);
+
+    // Unmaps the old cache and writes the new one if any file was added, changed or removed. Call once, after loading.
+    void Save();
+
+private:
+    enum class Kind : std::uint8_t {
+        kDefault,
+        kCustom,
+        kAddOn
+    };
+
+    struct MappedEntry {
+        Kind kind;
+        FileStamp stamp;
+        std::span<const std::byte> payload;
+    };
+
+    struct FreshEntry {
+        Kind kind;
+        FileStamp stamp;
+        std::vector<std::byte> payload;
+    };
+
+    static std::uint64_t ComputeKey();
+
+    void Map_();
+    void Unmap_();
+    // validates the header against key_ and indexes the entries; clears the index on any mismatch
+    void Index_();
+    // returns the payload of a usable entry and marks it as kept
+    std::optional<std::span<const std::byte>> Lookup_(const std::string& filename, Kind kind, const FileStamp& stamp);
+    void Insert_(const std::string& filename, Kind kind, const FileStamp& stamp, std::vector<std::byte> payload);
+    template <class T>
+    bool Find_(const std::string& filename, Kind kind, const FileStamp& stamp, T& a_out);
+
+    std::uint64_t key_;
+
+    void* file_ = nullptr;
+    void* mapping_ = nullptr;
+    const std::byte* view_ = nullptr;
+    size_t view_size_ = 0;
+
+    // immutable after construction
+    std::unordered_map<std::string, MappedEntry> index_;
+
+    std::mutex mutex_;
+    // [locks: mutex_] entries reused from the mapped cache, with their current stamp
+    std::unordered_map<std::string, FileStamp> kept_;
+    // [locks: mutex_] entries parsed during this load
+    std::unordered_map<std::string, FreshEntry> fresh_;
+};
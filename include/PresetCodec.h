@@ -0,0 +1,231 @@
+#pragma once
+#include "CustomObjects.h"
+
+// Byte encoding of the parsed preset settings stored in the PresetCache. Plain C++ so it builds anywhere; the
+// cache file itself (mapping, header, entries) is PresetCache's business.
+namespace PresetCodec {
+    class Writer {
+    public:
+        explicit Writer(std::vector<std::byte>& a_out) : out_(a_out) {}
+
+        template <class T> requires std::is_arithmetic_v<T>
+        void operator()(const T value) {
+            if constexpr (std::is_same_v<T, bool>) {
+                (*this)(static_cast<std::uint8_t>(value));
+            } else {
+                const auto* bytes = reinterpret_cast<const std::byte*>(&value);
+                out_.insert(out_.end(), bytes, bytes + sizeof(T));
+            }
+        }
+
+        void operator()(const std::string& str) {
+            (*this)(static_cast<std::uint32_t>(str.size()));
+            const auto* bytes = reinterpret_cast<const std::byte*>(str.data());
+            out_.insert(out_.end(), bytes, bytes + str.size());
+        }
+
+        template <class A, class B>
+        void operator()(const std::pair<A, B>& pair) {
+            (*this)(pair.first);
+            (*this)(pair.second);
+        }
+
+        template <std::ranges::sized_range R>
+        void operator()(const R& range) {
+            (*this)(static_cast<std::uint32_t>(std::ranges::size(range)));
+            for (const auto& element : range) (*this)(element);
+        }
+
+        void operator()(const StageEffect& effect) {
+            (*this)(effect.beffect);
+            (*this)(effect.magnitude);
+            (*this)(effect.duration);
+        }
+
+        void operator()(const AddOnSettings& settings);
+        void operator()(const DefaultSettings& settings);
+
+    private:
+        std::vector<std::byte>& out_;
+    };
+
+    // Reads what Writer wrote. Never reads past the payload; a truncated or corrupt payload only clears ok().
+    class Reader {
+    public:
+        explicit Reader(const std::span<const std::byte> a_data) : data_(a_data) {}
+
+        [[nodiscard]] bool ok() const { return ok_; }
+        [[nodiscard]] bool AtEnd() const { return pos_ == data_.size(); }
+
+        template <class T> requires std::is_arithmetic_v<T>
+        void operator()(T& value) {
+            if constexpr (std::is_same_v<T, bool>) {
+                std::uint8_t byte = 0;
+                (*this)(byte);
+                value = byte != 0;
+            } else {
+                if (!Has(sizeof(T))) {
+                    value = T{};
+                    return;
+                }
+                std::memcpy(&value, data_.data() + pos_, sizeof(T));
+                pos_ += sizeof(T);
+            }
+        }
+
+        void operator()(std::string& str) {
+            const auto size = ReadCount();
+            if (!Has(size)) return;
+            str.assign(reinterpret_cast<const char*>(data_.data() + pos_), size);
+            pos_ += size;
+        }
+
+        template <class A, class B>
+        void operator()(std::pair<A, B>& pair) {
+            (*this)(pair.first);
+            (*this)(pair.second);
+        }
+
+        template <class T>
+        void operator()(std::vector<T>& vec) {
+            const auto size = ReadCount();
+            vec.clear();
+            vec.reserve(size);
+            for (std::uint32_t i = 0; i < size && ok_; ++i) {
+                (*this)(vec.emplace_back());
+            }
+        }
+
+        template <class K, class V, class... Rest>
+        void operator()(std::map<K, V, Rest...>& map) { ReadMap(map); }
+
+        template <class K, class V, class... Rest>
+        void operator()(std::unordered_map<K, V, Rest...>& map) { ReadMap(map); }
+
+        template <class K, class... Rest>
+        void operator()(std::unordered_set<K, Rest...>& set) {
+            const auto size = ReadCount();
+            set.clear();
+            set.reserve(size);
+            for (std::uint32_t i = 0; i < size && ok_; ++i) {
+                K key{};
+                (*this)(key);
+                set.insert(std::move(key));
+            }
+        }
+
+        void operator()(StageEffect& effect) {
+            (*this)(effect.beffect);
+            (*this)(effect.magnitude);
+            (*this)(effect.duration);
+        }
+
+        void operator()(AddOnSettings& settings);
+        void operator()(DefaultSettings& settings);
+
+    private:
+        bool Has(const size_t n) {
+            if (!ok_ || data_.size() - pos_ < n) {
+                ok_ = false;
+                return false;
+            }
+            return true;
+        }
+
+        // every element takes at least one byte, so a count larger than what is left is corrupt
+        std::uint32_t ReadCount() {
+            std::uint32_t size = 0;
+            (*this)(size);
+            if (!Has(size)) return 0;
+            return size;
+        }
+
+        template <class Map>
+        void ReadMap(Map& map) {
+            const auto size = ReadCount();
+            map.clear();
+            if constexpr (requires { map.reserve(size); }) map.reserve(size);
+            for (std::uint32_t i = 0; i < size && ok_; ++i) {
+                typename Map::key_type key{};
+                typename Map::mapped_type value{};
+                (*this)(key);
+                (*this)(value);
+                map.emplace(std::move(key), std::move(value));
+            }
+        }
+
+        std::span<const std::byte> data_;
+        size_t pos_ = 0;
+        bool ok_ = true;
+    };
+
+    // single field list for both directions
+    template <class Archive, class S>
+    void VisitAddOn(Archive& ar, S& s) {
+        ar(s.containers);
+
+        ar(s.delayers);
+        ar(s.delayers_order);
+        ar(s.delayer_colors);
+        ar(s.delayer_sounds);
+        ar(s.delayer_artobjects);
+        ar(s.delayer_effect_shaders);
+        ar(s.delayer_containers);
+        ar(s.delayer_allowed_stages);
+
+        ar(s.transformers);
+        ar(s.transformers_order);
+        ar(s.transformer_colors);
+        ar(s.transformer_sounds);
+        ar(s.transformer_artobjects);
+        ar(s.transformer_effect_shaders);
+        ar(s.transformer_containers);
+        ar(s.transformer_allowed_stages);
+    }
+
+    template <class Archive, class S>
+    void VisitDefault(Archive& ar, S& s) {
+        ar(s.items);
+        ar(s.durations);
+        ar(s.stage_names);
+        ar(s.crafting_allowed);
+        ar(s.costoverrides);
+        ar(s.weightoverrides);
+        ar(s.effects);
+        ar(s.numbers);
+        ar(s.decayed_id);
+        ar(s.colors);
+        ar(s.sounds);
+        ar(s.artobjects);
+        ar(s.effect_shaders);
+    }
+
+    inline void Writer::operator()(const AddOnSettings& settings) { VisitAddOn(*this, settings); }
+
+    inline void Writer::operator()(const DefaultSettings& settings) {
+        VisitAddOn(*this, static_cast<const AddOnSettings&>(settings));
+        VisitDefault(*this, settings);
+    }
+
+    inline void Reader::operator()(AddOnSettings& settings) { VisitAddOn(*this, settings); }
+
+    inline void Reader::operator()(DefaultSettings& settings) {
+        VisitAddOn(*this, static_cast<AddOnSettings&>(settings));
+        VisitDefault(*this, settings);
+    }
+
+    template <class T>
+    std::vector<std::byte> Encode(const T& value) {
+        std::vector<std::byte> payload;
+        Writer writer(payload);
+        writer(value);
+        return payload;
+    }
+
+    template <class T>
+    bool Decode(const std::span<const std::byte> payload, T& a_out) {
+        Reader reader(payload);
+        reader(a_out);
+        return reader.ok() && reader.AtEnd();
+    }
+}
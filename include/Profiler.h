@@ -0,0 +1,85 @@
+#pragma once
+
+// Opt-in timing of the stage-evolution hot paths (configure with -DENABLE_AOT_PROFILING=ON).
+// Each AOT_PROFILE_SCOPE("name") owns one static Site, so the cost when enabled is two clock reads, two allocation
+// counter reads and a few relaxed atomics per call. Without AOT_PROFILE it expands to nothing.
+// Allocations are only counted when the host installs a counter (the headless benchmarks in bench/ do); the plugin
+// leaves the game's allocator alone.
+namespace Profiler {
+    struct Site {
+        const char* name;
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> max_ns{0};
+        std::atomic<uint64_t> allocs{0};
+        Site* next = nullptr;
+
+        explicit Site(const char* a_name);
+
+        void Record(uint64_t ns, uint64_t n_allocs);
+        void Reset();
+    };
+
+    struct Stats {
+        const char* name;
+        uint64_t calls;
+        double ns_per_op;
+        uint64_t max_ns;
+        double allocs_per_op;
+    };
+
+    // Returns the number of allocations the calling thread has made so far.
+    using AllocationCounter = uint64_t (*)();
+
+    // Not thread-safe; install it before any profiled code runs.
+    void SetAllocationCounter(AllocationCounter a_counter);
+
+    [[nodiscard]] bool CountsAllocations();
+
+    // Allocations made by the calling thread so far, or 0 without an allocation counter.
+    uint64_t ThreadAllocations();
+
+    // Sites with at least one call, slowest total first.
+    std::vector<Stats> Snapshot();
+
+    void ResetAll();
+
+    [[nodiscard]] constexpr bool Enabled() {
+#ifdef AOT_PROFILE
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(Site& a_site)
+            : site_(a_site), allocs_(ThreadAllocations()), start_(std::chrono::steady_clock::now()) {
+        }
+
+        ~ScopedTimer() {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start_).count();
+            site_.Record(static_cast<uint64_t>(ns), ThreadAllocations() - allocs_);
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        Site& site_;
+        uint64_t allocs_;
+        std::chrono::steady_clock::time_point start_;
+    };
+}
+
+#ifdef AOT_PROFILE
+#define AOT_PROFILE_CONCAT_INNER(a,b) a##b
+#define AOT_PROFILE_CONCAT(a,b) AOT_PROFILE_CONCAT_INNER(a,b)
+#define AOT_PROFILE_SCOPE(name)                                                                        \
+    static Profiler::Site AOT_PROFILE_CONCAT(aot_prof_site_, __LINE__){name};                         \
+    const Profiler::ScopedTimer AOT_PROFILE_CONCAT(aot_prof_timer_, __LINE__){AOT_PROFILE_CONCAT(aot_prof_site_, __LINE__)}
+#else
+#define AOT_PROFILE_SCOPE(name) ((void)0)
+#endif
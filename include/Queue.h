@@ -1,6 +1,8 @@
 #pragma once
 #include <REX/REX/Singleton.h>
 #include "ClibUtilsQTR/Ticker.hpp"
+#include "MPSCRing.h"
+#include "TransferBatch.h"
 
 struct AddItemTask {
     RefID to = 0;
@@ -32,23 +34,22 @@ class QueueManager : public REX::Singleton<QueueManager>, public RE::BSTEventSin
     Ticker ticker{[this]() { UpdateLoop(); }, std::chrono::milliseconds(ticker_speed)};
     //Ticker player_ticker{[this]() { UpdateLoopPlayer(); }, std::chrono::milliseconds(player_ticker_speed)};
 
-    struct Transfer {
-        FormID what{0};
-        Count count{0};
-        RefID from_refid{0};
-    };
+    using Transfer = ItemTransfer;
 
-    using Key = std::pair<RefID, RefID>;
+    static constexpr size_t transfer_ring_size = 4096;
 
-    struct KeyHash {
-        std::size_t operator()(const Key& k) const noexcept;
-    };
+    MPSCRing<Transfer, transfer_ring_size> transfer_ring_;
+    // held by whichever thread is draining transfer_ring_
+    std::atomic_flag draining_;
+    // drainer only
+    std::vector<Transfer> drained_;
+    uint64_t n_overflows_ = 0;
 
-    using PendingMap = std::unordered_map<Key, std::deque<Transfer>, KeyHash>;
-    using WorkItem = std::pair<Key, Transfer>;
+    // Transfers recorded while the ring was full; set until the next drain takes them, so later ones stay behind.
+    std::atomic<bool> overflowed_{false};
+    std::mutex overflow_mutex_;
+    std::vector<Transfer> overflow_;
 
-    std::mutex mutex_process_;
-    PendingMap pending_process;
     std::mutex mutex_moveitem_;
     std::unordered_map<RefID, std::deque<AddRemoveItemTask>> pending_moveitem_;
 
@@ -57,7 +58,8 @@ class QueueManager : public REX::Singleton<QueueManager>, public RE::BSTEventSin
                                        RE::TESObjectREFR::InventoryItemMap& inventory);
 
     bool ProcessPendingMoves(int n_tasks);
-    void ProcessPendingProcess(int n_tasks);
+
+    static void ApplyTransfers(const std::vector<Transfer>& transfers);
 
     static void RefreshUI();
 
@@ -71,14 +73,16 @@ public:
         //player_ticker.Start();
     }
 
-    // doesnt run on game thread. unsafe as is.
-    /*void QueueUpdate(const RE::TESObjectREFR* from, const RE::TESObjectREFR* to = nullptr,
-                     const RE::TESForm* what = nullptr,
-                     Count count = 0, RefID from_refid = 0);*/
+    // Records a transfer from the inventory hooks: a few atomics, no Manager locks, never waits. When the ring is
+    // full the transfer goes to a mutex-guarded overflow list that the next drain applies after the ring.
+    void QueueUpdate(RE::TESObjectREFR* from, RE::TESObjectREFR* to, const RE::TESForm* what,
+                     Count count, RefID from_refid = 0);
+
+    // Coalesces and applies the queued transfers. Game thread; returns at once if another thread is draining.
+    void DrainUpdates();
 
     void QueueAddRemoveItemTask(const AddItemTask& add_task, const RemoveItemTask& remove_task);
 
-    PendingMap RequestPendingProcess(int n_pending);
     std::unordered_map<RefID, std::vector<AddRemoveItemTask>> RequestPendingMoveItem(int n_pending);
     bool HasPendingMoveItemTasks();
 
@@ -0,0 +1,40 @@
+#pragma once
+#include "CustomObjects.h"
+
+// Immutable view of the Manager's instance state. The Manager publishes a new one at most once per frame and per
+// ticker tick (RCU style, like CellScanner::Publish_) and readers keep whichever version they loaded for as long as
+// they need. Locations are sharded by refid so a publish only copies the shards it touched, and a copied shard
+// shares the views of its untouched locations with the previous version.
+struct ReadModel {
+    struct LocationView {
+        // every instance of every source at the location
+        std::vector<StageRow> rows;
+        // bases the CellScanner should collect around the location if it is a world object
+        std::vector<FormID> scan_bases;
+    };
+
+    struct Shard {
+        std::unordered_map<RefID, std::shared_ptr<const LocationView>> locations;
+        size_t n_instances = 0;
+    };
+
+    static constexpr size_t n_shards = 64;
+
+    uint64_t epoch = 0;
+    size_t n_instances = 0;
+    // null until the first publish
+    std::array<std::shared_ptr<const Shard>, n_shards> shards;
+    std::shared_ptr<const std::vector<SourceSummary>> summaries;
+
+    [[nodiscard]] static size_t ShardOf(const RefID loc) {
+        // fibonacci hashing; refids of one plugin share their high byte
+        return static_cast<size_t>((loc * 0x9E3779B1u) >> 26);
+    }
+
+    [[nodiscard]] const LocationView* Find(const RefID loc) const {
+        const auto& shard = shards[ShardOf(loc)];
+        if (!shard) return nullptr;
+        const auto it = shard->locations.find(loc);
+        return it != shard->locations.end() ? it->second.get() : nullptr;
+    }
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+// Indexed binary min-heap of (stop_time, refid). Lets the Manager ticker pop only the RefStops that are due
+// instead of scanning the whole queue, and reschedule an existing ref in O(log N).
+// Not thread-safe: the Manager guards it with queueMutex_ together with _ref_stops_.
+class RefStopSchedule {
+public:
+    // Inserts refid or moves it to its new stop time.
+    void Push(const RefID refid, const float stop_time) {
+        if (const auto it = pos_.find(refid); it != pos_.end()) {
+            const size_t i = it->second;
+            const float old = heap_[i].stop_time;
+            heap_[i].stop_time = stop_time;
+            if (stop_time < old) SiftUp(i);
+            else if (stop_time > old) SiftDown(i);
+            return;
+        }
+        heap_.push_back({stop_time, refid});
+        pos_[refid] = heap_.size() - 1;
+        SiftUp(heap_.size() - 1);
+    }
+
+    bool Erase(const RefID refid) {
+        const auto it = pos_.find(refid);
+        if (it == pos_.end()) return false;
+        const size_t i = it->second;
+        pos_.erase(it);
+        const size_t last = heap_.size() - 1;
+        if (i != last) {
+            heap_[i] = heap_[last];
+            pos_[heap_[i].refid] = i;
+            heap_.pop_back();
+            SiftDown(i);
+            SiftUp(i);
+        } else {
+            heap_.pop_back();
+        }
+        return true;
+    }
+
+    // Pops every entry with stop_time <= curr_time into a_out, earliest first.
+    void PopDue(const float curr_time, std::vector<RefID>& a_out) {
+        while (!heap_.empty() && heap_.front().stop_time <= curr_time) {
+            a_out.push_back(heap_.front().refid);
+            Erase(heap_.front().refid);
+        }
+    }
+
+    [[nodiscard]] std::optional<float> NextStopTime() const {
+        if (heap_.empty()) return std::nullopt;
+        return heap_.front().stop_time;
+    }
+
+    [[nodiscard]] bool Contains(const RefID refid) const { return pos_.contains(refid); }
+    [[nodiscard]] bool Empty() const { return heap_.empty(); }
+    [[nodiscard]] size_t Size() const { return heap_.size(); }
+
+    void Clear() {
+        heap_.clear();
+        pos_.clear();
+    }
+
+private:
+    struct Node {
+        float stop_time;
+        RefID refid;
+    };
+
+    std::vector<Node> heap_;
+    std::unordered_map<RefID, size_t> pos_;
+
+    [[nodiscard]] bool Less(const size_t a, const size_t b) const {
+        if (heap_[a].stop_time != heap_[b].stop_time) return heap_[a].stop_time < heap_[b].stop_time;
+        return heap_[a].refid < heap_[b].refid;
+    }
+
+    void Swap(const size_t a, const size_t b) {
+        std::swap(heap_[a], heap_[b]);
+        pos_[heap_[a].refid] = a;
+        pos_[heap_[b].refid] = b;
+    }
+
+    void SiftUp(size_t i) {
+        while (i > 0) {
+            const size_t parent = (i - 1) / 2;
+            if (!Less(i, parent)) break;
+            Swap(i, parent);
+            i = parent;
+        }
+    }
+
+    void SiftDown(size_t i) {
+        const size_t n = heap_.size();
+        while (true) {
+            const size_t l = 2 * i + 1;
+            const size_t r = l + 1;
+            size_t smallest = i;
+            if (l < n && Less(l, smallest)) smallest = l;
+            if (r < n && Less(r, smallest)) smallest = r;
+            if (smallest == i) break;
+            Swap(i, smallest);
+            i = smallest;
+        }
+    }
+};
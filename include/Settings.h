@@ -3,6 +3,8 @@
 #include <yaml-cpp/yaml.h>
 #include "rapidjson/document.h"
 
+class PresetCache;
+
 
 namespace Settings {
     constexpr std::uint32_t kSerializationVersion = 627;
@@ -36,14 +38,30 @@ namespace Settings {
     inline std::atomic world_objects_evolve = false;
     inline std::atomic placed_objects_evolve = false;
     inline std::atomic unowned_objects_evolve = false;
+    // inventory catch-up walks every stage boundary with a full pass instead of the closed-form fast-forward
+    inline std::atomic stepwise_catch_up = false;
+    // resolve the settings of every form of the enabled modules at load instead of on first use
+    inline bool prewarm_settings = false;
     inline float proximity_range = 20.f;
 
     inline float search_radius = 1000.f;
+    // world object level of detail: near/far tier distances to the player and the game-hour grid the stop times
+    // of mid and far objects are snapped to
+    inline float lod_near_distance = 4096.f;
+    inline float lod_far_distance = 12288.f;
+    inline float lod_mid_step = 0.25f;
+    inline float lod_far_step = 1.f;
+    // player movement after which world objects are re-tiered
+    inline float lod_retier_distance = 1024.f;
     inline float max_modulator_strength = 1000000.f;
     inline float critical_stage_dur = 9999.f;
     constexpr size_t max_dirty_updates_min = 1;
     constexpr size_t max_dirty_updates_max = 10000;
     inline std::atomic<size_t> max_dirty_updates = 100;
+    // time the per-frame dirty ref updates may take before the rest waits for the next frame
+    constexpr uint32_t dirty_update_budget_us_min = 100;
+    constexpr uint32_t dirty_update_budget_us_max = 20000;
+    inline std::atomic<uint32_t> dirty_update_budget_us = 1000;
 
     namespace Ticker {
         enum Intervals {
@@ -111,6 +129,38 @@ namespace Settings {
     inline int GetCurrentTickInterval() { return GetInterval(ticker_speed); }
     void SetCurrentTickInterval(Ticker::Intervals interval);
 
+    // POPULATE THIS (with qformRules in Settings.cpp)
+    enum class QForm : std::uint8_t {
+        kFOOD,
+        kINGR,
+        kMEDC,
+        kPOSN,
+        kARMO,
+        kWEAP,
+        kSCRL,
+        kBOOK,
+        kSLGM,
+        kMISC,
+        kTotal,
+        kNone = kTotal
+    };
+
+    constexpr size_t n_qforms = std::to_underlying(QForm::kTotal);
+    constexpr std::array<std::string_view, n_qforms> qform_names = {"FOOD", "INGR", "MEDC", "POSN", "ARMO",
+                                                                    "WEAP", "SCRL", "BOOK", "SLGM", "MISC"};
+
+    // empty for kNone
+    constexpr std::string_view QFormName(const QForm qform) {
+        return qform == QForm::kNone ? std::string_view{} : qform_names[std::to_underlying(qform)];
+    }
+
+    constexpr QForm QFormFromName(const std::string_view name) {
+        for (size_t i = 0; i < n_qforms; ++i) {
+            if (qform_names[i] == name) return static_cast<QForm>(i);
+        }
+        return QForm::kNone;
+    }
+
     const std::vector<std::string> fakes_allowedQFORMS = {"FOOD", "MISC"};
     //const std::vector<std::string> xQFORMS = {"ARMO", "WEAP", "SLGM", "MEDC", "POSN"};
     // xdata is carried over in item transitions
@@ -133,6 +183,8 @@ namespace Settings {
 
     // fast overloads (no FormReader lookups)
     bool IsQFormType(const RE::TESForm* form, std::string_view qformtype);
+    // first enabled module that classifies form, through a table keyed by form type built when settings load
+    QForm GetQForm(const RE::TESForm* form);
     std::string_view GetQFormType(const RE::TESForm* form);
 
     bool IsInExclude(const RE::TESForm* form, std::string_view type);
@@ -143,7 +195,7 @@ namespace Settings {
 
     [[nodiscard]] bool IsQFormType(FormID formid, const std::string& qformtype);
 
-    inline std::string GetQFormType(FormID formid);
+    std::string GetQFormType(FormID formid);
 
     bool IsSpecialQForm(RE::TESObjectREFR* ref);
 
@@ -167,7 +219,8 @@ namespace PresetParse {
     std::vector<std::string> LoadExcludeList(const std::string& postfix);
     AddOnSettings parseAddOns_(const YAML::Node& config);
     DefaultSettings parseDefaults_(const YAML::Node& config);
-    DefaultSettings parseDefaults(const std::string& _type);
+    // with a cache, unchanged files are read from it instead of being parsed
+    DefaultSettings parseDefaults(const std::string& _type, PresetCache* cache = nullptr);
 
     void LoadINISettings();
     void LoadJSONSettings();
@@ -1,68 +1,180 @@
 #pragma once
-#include <future>
-#include <queue>
+#include <deque>
 
-class ThreadPool {
+// Number of scheduler workers
+inline size_t numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+// Process-wide work-stealing scheduler. Every worker owns a deque: it pushes and pops its own tasks at the back
+// and steals from the front of the others when it runs dry. Tasks submitted from outside go round robin.
+// Threads waiting on a TaskGroup run queued tasks instead of blocking, so nested fork/join needs no extra threads.
+// Started on first use and never torn down (workers sleep when idle).
+class TaskScheduler {
 public:
-    explicit ThreadPool(const size_t numThreads) {
-        for (size_t i = 0; i < numThreads; ++i) {
-            workers.emplace_back([this] {
-                while (true) {
-                    std::function<void()> task;
-                    {
-                        std::unique_lock lock(queueMutex);
-                        condition.wait(lock, [this] { return stop || !tasks.empty(); });
-                        if (stop && tasks.empty()) return;
-                        task = std::move(tasks.front());
-                        tasks.pop();
-                    }
-                    task();
-                }
-            });
+    using Task = std::function<void()>;
+
+    static TaskScheduler& Get() {
+        static auto* scheduler = new TaskScheduler(numThreads);
+        return *scheduler;
+    }
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    void Submit(Task task) {
+        const size_t target = tls_scheduler == this
+                                  ? tls_worker
+                                  : next_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+        {
+            std::lock_guard lock(workers_[target]->mutex);
+            workers_[target]->tasks.push_back(std::move(task));
         }
+        queued_.fetch_add(1, std::memory_order_release);
+        Notify(false);
+    }
+
+    // Runs one queued task on the calling thread: a worker takes its own newest first, then steals the oldest.
+    bool RunOne() {
+        Task task;
+        if (!Take(task)) return false;
+        task();
+        return true;
     }
 
-    ~ThreadPool() {
+    // Sleeps until notified or the timeout passes. Callers re-check their own condition.
+    void WaitForWork(const std::chrono::milliseconds timeout) {
+        std::unique_lock lock(idle_mutex_);
+        if (queued_.load(std::memory_order_acquire) > 0) return;
+        idle_cv_.wait_for(lock, timeout);
+    }
+
+    void Notify(const bool all) {
         {
-            std::unique_lock lock(queueMutex);
-            stop = true;
+            std::lock_guard lock(idle_mutex_);
         }
-        condition.notify_all();
-        for (std::thread& worker : workers) {
-            worker.join();
+        if (all) idle_cv_.notify_all();
+        else idle_cv_.notify_one();
+    }
+
+    [[nodiscard]] size_t WorkerCount() const { return workers_.size(); }
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    explicit TaskScheduler(const size_t n_workers) {
+        workers_.reserve(n_workers);
+        for (size_t i = 0; i < n_workers; ++i) {
+            workers_.push_back(std::make_unique<Worker>());
+        }
+        for (size_t i = 0; i < n_workers; ++i) {
+            std::thread([this, i] {
+                tls_scheduler = this;
+                tls_worker = i;
+                for (;;) {
+                    if (RunOne()) continue;
+                    std::unique_lock lock(idle_mutex_);
+                    idle_cv_.wait(lock, [this] { return queued_.load(std::memory_order_acquire) > 0; });
+                }
+            }).detach();
         }
     }
 
-    template <class F, class... Args>
-    std::future<std::invoke_result_t<F, Args...>> enqueue(F&& f, Args&&... args) {
-        using return_type = std::invoke_result_t<F, Args...>;
+    bool Take(Task& a_task) {
+        const size_t n = workers_.size();
+        const bool is_worker = tls_scheduler == this;
+        const size_t self = is_worker ? tls_worker : next_.load(std::memory_order_relaxed) % n;
 
-        auto task = std::make_shared<std::packaged_task<return_type()>>(
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-            );
+        if (is_worker) {
+            auto& own = *workers_[self];
+            std::lock_guard lock(own.mutex);
+            if (!own.tasks.empty()) {
+                a_task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        for (size_t k = is_worker ? 1 : 0; k < n; ++k) {
+            auto& victim = *workers_[(self + k) % n];
+            std::lock_guard lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                a_task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<size_t> next_{0};
+    std::atomic<size_t> queued_{0};
+    std::mutex idle_mutex_;
+    std::condition_variable idle_cv_;
+
+    static inline thread_local TaskScheduler* tls_scheduler = nullptr;
+    static inline thread_local size_t tls_worker = 0;
+};
+
+// Fork/join over the TaskScheduler. Wait() helps run tasks until every task of the group is done, then rethrows
+// the first exception one of them threw, the way std::future::get() did for the old per-call thread pools.
+class TaskGroup {
+public:
+    explicit TaskGroup(TaskScheduler& a_scheduler = TaskScheduler::Get()) : scheduler_(a_scheduler) {}
 
-        std::future<return_type> res = task->get_future();
+    ~TaskGroup() {
+        try {
+            Wait();
+        } catch (const std::exception& ex) {
+            logger::error("TaskGroup: unhandled task exception: {}", ex.what());
+        }
+    }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    template <class F>
+    void Run(F&& f) {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        scheduler_.Submit([this, &scheduler = scheduler_, f = std::forward<F>(f)]() mutable {
+            try {
+                f();
+            } catch (...) {
+                std::lock_guard lock(error_mutex_);
+                if (!error_) error_ = std::current_exception();
+            }
+            // the group may be destroyed as soon as pending_ reaches 0, so notify through the scheduler reference
+            if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                scheduler.Notify(true);
+            }
+        });
+    }
+
+    void Wait() {
+        while (pending_.load(std::memory_order_acquire) != 0) {
+            if (!scheduler_.RunOne()) {
+                scheduler_.WaitForWork(std::chrono::milliseconds(1));
+            }
+        }
+        std::exception_ptr error;
         {
-            std::unique_lock lock(queueMutex);
-            if (stop) throw std::runtime_error("enqueue on stopped ThreadPool");
-            tasks.emplace([task]() { (*task)(); });
+            std::lock_guard lock(error_mutex_);
+            error = std::exchange(error_, nullptr);
         }
-        condition.notify_one();
-        return res;
+        if (error) std::rethrow_exception(error);
     }
 
 private:
-    std::vector<std::thread> workers;
-    std::queue<std::function<void()>> tasks;
-    std::mutex queueMutex;
-    std::condition_variable condition;
-    bool stop = false;
+    TaskScheduler& scheduler_;
+    std::atomic<size_t> pending_{0};
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
 };
 
-// Create a global thread pool instance
-inline size_t numThreads = std::max(1u, std::thread::hardware_concurrency());
-//inline ThreadPool pool(numThreads);
-
 
 class SpeedProfiler {
     std::chrono::time_point<std::chrono::steady_clock> start_time;
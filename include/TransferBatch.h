@@ -0,0 +1,72 @@
+#pragma once
+
+// An item transfer seen by the inventory hooks, by id so it stays valid until the game thread applies it.
+struct ItemTransfer {
+    RefID from{0};
+    RefID to{0};
+    FormID what{0};
+    Count count{0};
+    RefID from_refid{0};
+};
+
+// Sums repeated (from, to, what) transfers and nets opposite ones between the same two references, as long as
+// no transfer in between touches either reference; the order of the sequence is otherwise kept.
+// Transfers that end up at zero are dropped. The net count of every (reference, what) is unchanged.
+inline void CoalesceTransfers(std::vector<ItemTransfer>& transfers) {
+    struct Key {
+        RefID a;
+        RefID b;
+        FormID what;
+        RefID from_refid;
+        bool operator==(const Key&) const = default;
+    };
+    struct KeyHash {
+        std::size_t operator()(const Key& k) const noexcept {
+            const std::uint64_t refs = (static_cast<std::uint64_t>(k.a) << 32) | k.b;
+            const std::uint64_t rest = (static_cast<std::uint64_t>(k.what) << 32) | k.from_refid;
+            return std::hash<std::uint64_t>{}(refs ^ (rest * 0x9E3779B97F4A7C15ull));
+        }
+    };
+
+    std::unordered_map<Key, size_t, KeyHash> index;
+    index.reserve(transfers.size());
+    // ref -> last output slot that touches it
+    std::unordered_map<RefID, size_t> last_touch;
+    last_touch.reserve(transfers.size() * 2);
+    size_t n_out = 0;
+
+    for (size_t i = 0; i < transfers.size(); ++i) {
+        const auto t = transfers[i];
+        // only moves between two references can cancel out; adds from and removals to nowhere just add up
+        const bool nettable = t.from && t.to && !t.from_refid;
+        const bool flipped = nettable && t.to < t.from;
+        const Key key = flipped
+                            ? Key{t.to, t.from, t.what, 0}
+                            : Key{t.from, t.to, t.what, t.from_refid};
+        const std::array refs{t.from, t.to, t.from_refid};
+
+        // merge only into a slot no later transfer touched either reference of, so nothing is reordered
+        if (const auto it = index.find(key); it != index.end()) {
+            const auto slot = it->second;
+            if (std::ranges::all_of(refs, [&](const RefID ref) { return !ref || last_touch[ref] == slot; })) {
+                auto& out = transfers[slot];
+                out.count += out.from == t.from ? t.count : -t.count;
+                continue;
+            }
+        }
+        index.insert_or_assign(key, n_out);
+        for (const auto ref : refs) {
+            if (ref) last_touch[ref] = n_out;
+        }
+        transfers[n_out++] = t;
+    }
+    transfers.resize(n_out);
+
+    for (auto& t : transfers) {
+        if (t.count < 0) {
+            std::swap(t.from, t.to);
+            t.count = -t.count;
+        }
+    }
+    std::erase_if(transfers, [](const ItemTransfer& t) { return t.count == 0; });
+}
@@ -1,4 +1,6 @@
 #pragma once
+#include <deque>
+#include <shared_mutex>
 
 namespace Utils {
     const auto mod_name = std::string(SKSE::PluginDeclaration::GetSingleton()->GetName());
@@ -79,12 +81,42 @@ namespace Utils {
             bool operator<(const FormEditorID& other) const;
         };
 
-        struct FormEditorIDX : FormEditorID {
+        // Process-wide intern table for editor IDs, so stage instances carry a 32-bit handle instead of a
+        // std::string. Handle 0 is the empty string. Entries are never removed; views from Get stay valid.
+        class EditorIDPool {
+        public:
+            static EditorIDPool* GetSingleton() {
+                static EditorIDPool singleton;
+                return &singleton;
+            }
+
+            [[nodiscard]] uint32_t Intern(std::string_view a_editorid);
+            [[nodiscard]] std::string_view Get(uint32_t a_handle) const;
+
+            [[nodiscard]] size_t Size() const;
+            // string payload plus the handle index, roughly
+            [[nodiscard]] size_t Bytes() const;
+
+        private:
+            EditorIDPool();
+
+            mutable std::shared_mutex mutex_;
+            std::deque<std::string> strings_;
+            std::unordered_map<std::string_view, uint32_t> index_;
+            size_t bytes_ = 0;
+        };
+
+        uint32_t InternEditorID(const RE::TESForm* form);
+
+        struct FormEditorIDX {
+            FormID form_id = 0;
+            uint32_t editor_id = 0; // EditorIDPool handle
             bool is_fake = false;
             bool is_decayed = false;
             bool is_transforming = false;
             bool crafting_allowed = false;
 
+            [[nodiscard]] std::string_view GetEditorID() const;
 
             bool operator==(const FormEditorIDX& other) const;
         };
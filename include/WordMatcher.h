@@ -0,0 +1,122 @@
+#pragma once
+
+// Aho-Corasick automaton over a fixed list of words, so a text is checked against all of them in one pass.
+// Matches like StringHelpers::includesWord: case-insensitive, line breaks in the text count as spaces, and a word
+// must be delimited by spaces or the ends of the (trimmed) text. Each word carries an id; FirstMatch returns the
+// smallest id found, which lets callers keep "first list entry wins" semantics.
+// Build once, then read-only: concurrent FirstMatch/Matches calls are safe.
+class WordMatcher {
+public:
+    static constexpr uint32_t no_match = std::numeric_limits<uint32_t>::max();
+
+    void Add(const std::string_view word, const uint32_t id) {
+        std::string padded(" ");
+        for (const char c : Trim(word)) {
+            padded.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+        }
+        padded.push_back(' ');
+        words_.emplace_back(std::move(padded), id);
+    }
+
+    void Build() {
+        // only bytes that occur in some word get their own column; everything else shares column 0
+        columns_.fill(0);
+        n_columns_ = 1;
+        for (const auto& word : words_ | std::views::keys) {
+            for (const unsigned char c : word) {
+                if (!columns_[c]) columns_[c] = static_cast<uint16_t>(n_columns_++);
+            }
+        }
+
+        next_.assign(n_columns_, no_match);
+        out_.assign(1, no_match);
+        for (const auto& [word, id] : words_) {
+            uint32_t state = 0;
+            for (const unsigned char c : word) {
+                auto& slot = next_[state * n_columns_ + columns_[c]];
+                if (slot == no_match) {
+                    slot = static_cast<uint32_t>(out_.size());
+                    out_.push_back(no_match);
+                    next_.resize(next_.size() + n_columns_, no_match);
+                }
+                state = next_[state * n_columns_ + columns_[c]];
+            }
+            out_[state] = std::min(out_[state], id);
+        }
+
+        // breadth first: suffix links, inherited outputs, and missing transitions filled in so Scan never backtracks
+        std::vector<uint32_t> fail(out_.size(), 0);
+        std::vector<uint32_t> queue;
+        queue.reserve(out_.size());
+        for (size_t col = 0; col < n_columns_; ++col) {
+            auto& child = next_[col];
+            if (child == no_match) child = 0;
+            else queue.push_back(child);
+        }
+        for (size_t head = 0; head < queue.size(); ++head) {
+            const uint32_t state = queue[head];
+            out_[state] = std::min(out_[state], out_[fail[state]]);
+            for (size_t col = 0; col < n_columns_; ++col) {
+                auto& child = next_[state * n_columns_ + col];
+                const uint32_t fallback = next_[fail[state] * n_columns_ + col];
+                if (child == no_match) {
+                    child = fallback;
+                } else {
+                    fail[child] = fallback;
+                    queue.push_back(child);
+                }
+            }
+        }
+        words_.clear();
+        words_.shrink_to_fit();
+    }
+
+    // smallest id of the words found in text, no_match if none
+    [[nodiscard]] uint32_t FirstMatch(const std::string_view text) const { return Scan(text, false); }
+
+    [[nodiscard]] bool Matches(const std::string_view text) const { return Scan(text, true) != no_match; }
+
+    [[nodiscard]] bool Empty() const { return out_.size() <= 1; }
+
+    [[nodiscard]] size_t StateCount() const { return out_.size(); }
+
+private:
+    static bool IsSpace(const unsigned char c) { return std::isspace(c) != 0; }
+
+    static std::string_view Trim(std::string_view text) {
+        while (!text.empty() && IsSpace(text.front())) text.remove_prefix(1);
+        while (!text.empty() && IsSpace(text.back())) text.remove_suffix(1);
+        return text;
+    }
+
+    static char Fold(const unsigned char c) {
+        if (c == '\n' || c == '\r') return ' ';
+        return static_cast<char>(std::tolower(c));
+    }
+
+    uint32_t Scan(const std::string_view text, const bool any) const {
+        if (Empty()) return no_match;
+        uint32_t best = no_match;
+        uint32_t state = 0;
+        auto step = [&](const char c) {
+            state = next_[state * n_columns_ + columns_[static_cast<unsigned char>(c)]];
+            best = std::min(best, out_[state]);
+        };
+        step(' ');
+        for (const char c : Trim(text)) {
+            step(Fold(static_cast<unsigned char>(c)));
+            if (any && best != no_match) return best;
+        }
+        step(' ');
+        return best;
+    }
+
+    std::vector<std::pair<std::string, uint32_t>> words_;
+
+    std::array<uint16_t, 256> columns_{};
+    size_t n_columns_ = 1;
+    // dense transition table, n_columns_ entries per state
+    std::vector<uint32_t> next_;
+    // smallest word id ending at each state, including those reached through suffix links
+    std::vector<uint32_t> out_;
+};
@@ -1,5 +1,7 @@
 #include "CellScan.h"
+#include <immintrin.h>
 #include <unordered_set>
+#include "Settings.h"
 #include "Utils.h"
 
 
@@ -12,6 +14,8 @@ void CellScanner::RequestRefresh(const std::vector<Request>& requests) {
     }
 
     if (work->bases->empty() || work->refInfos->empty()) {
+        // the next indexed refresh must publish even if no cell changed
+        forcePublish_.store(true, std::memory_order_release);
         Publish_(std::move(work->next));
         return;
     }
@@ -20,6 +24,14 @@ void CellScanner::RequestRefresh(const std::vector<Request>& requests) {
 }
 
 
+void CellScanner::MarkRefDirty(const RefID refid) {
+    if (!refid) {
+        return;
+    }
+    std::lock_guard lock(dirtyMutex_);
+    dirtyRefs_.insert(refid);
+}
+
 CellScanner::CachePtr CellScanner::GetCache() const {
     std::shared_lock lock(cacheMutex_);
     return cache_;
@@ -64,12 +76,13 @@ void CellScanner::QueueScanTask_(WorkItemPtr work) {
     SKSE::GetTaskInterface()->AddTask([this, work]() { RunScanTaskOnGameThread_(work); });
 }
 
-void CellScanner::Publish_(std::shared_ptr<Cache> next) {
+bool CellScanner::Publish_(std::shared_ptr<Cache> next) {
     if (!next || IsStale_(next->generation)) {
-        return;
+        return false;
     }
     std::unique_lock lock(cacheMutex_);
     cache_ = std::move(next);
+    return true;
 }
 
 void CellScanner::TryAddExteriorCell_(RE::TESWorldSpace* ws, const std::int32_t x, const std::int32_t y,
@@ -135,38 +148,148 @@ void CellScanner::CollectCellsToScan_(const std::vector<RefInfo>& refInfos,
     }
 }
 
-void CellScanner::ScanCells_(const std::unordered_set<RE::TESObjectCELL*>& cellsToScan,
-                             const std::unordered_set<FormID>& basesOfInterest, Cache& outCache) {
-    for (const auto cell : cellsToScan) {
-        if (!cell) {
-            continue;
+std::uint64_t CellScanner::FingerprintEntry_(const FormID base, const Entry& e) {
+    // positions are rounded to whole units so float jitter of resting objects does not count as a change
+    std::uint64_t h = 1469598103934665603ull;
+    for (const std::uint64_t v : {static_cast<std::uint64_t>(base), static_cast<std::uint64_t>(e.refid),
+                                  static_cast<std::uint64_t>(std::lround(e.pos.x)),
+                                  static_cast<std::uint64_t>(std::lround(e.pos.y)),
+                                  static_cast<std::uint64_t>(std::lround(e.pos.z))}) {
+        h ^= v;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+void CellScanner::ScanCell_(RE::TESObjectCELL* cell, const std::unordered_set<FormID>& basesOfInterest,
+                            CellEntries& out) {
+    if (!cell) {
+        return;
+    }
+
+    auto callback = [&out, &basesOfInterest](const RE::TESObjectREFR* ref) -> RE::BSContainer::ForEachResult {
+        if (!ref || ref->IsDisabled() || ref->IsDeleted() || ref->IsMarkedForDeletion()) {
+            return RE::BSContainer::ForEachResult::kContinue;
         }
 
-        auto callback = [&outCache, &basesOfInterest](const RE::TESObjectREFR* ref) -> RE::BSContainer::ForEachResult {
-            if (!ref || ref->IsDisabled() || ref->IsDeleted() || ref->IsMarkedForDeletion()) {
-                return RE::BSContainer::ForEachResult::kContinue;
-            }
+        const auto base = ref->GetObjectReference();
+        if (!base) {
+            return RE::BSContainer::ForEachResult::kContinue;
+        }
 
-            const auto base = ref->GetObjectReference();
-            if (!base) {
-                return RE::BSContainer::ForEachResult::kContinue;
-            }
+        const auto baseID = base->GetFormID();
+        if (!basesOfInterest.contains(baseID)) {
+            return RE::BSContainer::ForEachResult::kContinue;
+        }
+
+        Entry e;
+        e.refid = ref->GetFormID();
+        e.pos = Utils::WorldObject::GetPosition(ref);
+        out.emplace_back(baseID, e);
+
+        return RE::BSContainer::ForEachResult::kContinue;
+    };
+
+    cell->ForEachReference(callback);
+}
 
-            const auto baseID = base->GetFormID();
-            if (!basesOfInterest.contains(baseID)) {
-                return RE::BSContainer::ForEachResult::kContinue;
+void CellScanner::DropCell_(const FormID cellID) {
+    const auto it = cellIndex_.find(cellID);
+    if (it == cellIndex_.end()) {
+        return;
+    }
+    for (const auto& e : it->second | std::views::values) {
+        if (const auto rc = refCell_.find(e.refid); rc != refCell_.end() && rc->second == cellID) {
+            refCell_.erase(rc);
+        }
+    }
+    cellIndex_.erase(it);
+}
+
+bool CellScanner::UpdateIndex_(const std::unordered_set<RE::TESObjectCELL*>& cells,
+                               const std::unordered_set<FormID>& bases) {
+    bool changed = false;
+
+    // a base the index was not scanned for is missing from every cell
+    if (!std::ranges::all_of(bases, [this](const FormID base) { return indexedBases_.contains(base); })) {
+        cellIndex_.clear();
+        refCell_.clear();
+        indexedBases_ = bases;
+        changed = true;
+    }
+
+    std::unordered_set<RefID> dirtyRefs;
+    {
+        std::lock_guard lock(dirtyMutex_);
+        dirtyRefs.swap(dirtyRefs_);
+    }
+    std::unordered_set<FormID> dirtyCells;
+    for (const auto refid : dirtyRefs) {
+        if (const auto it = refCell_.find(refid); it != refCell_.end()) {
+            dirtyCells.insert(it->second);
+        }
+        if (const auto ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(refid)) {
+            if (const auto cell = ref->GetParentCell()) {
+                dirtyCells.insert(cell->GetFormID());
             }
+        }
+    }
 
-            Entry e;
-            e.refid = ref->GetFormID();
-            e.pos = Utils::WorldObject::GetPosition(ref);
-            outCache.byBase[baseID].push_back(e);
+    std::unordered_map<FormID, RE::TESObjectCELL*> current;
+    current.reserve(cells.size());
+    for (const auto cell : cells) {
+        if (cell) {
+            current.emplace(cell->GetFormID(), cell);
+        }
+    }
 
-            return RE::BSContainer::ForEachResult::kContinue;
-        };
+    // detached
+    std::vector<FormID> detached;
+    for (const auto cellID : cellIndex_ | std::views::keys) {
+        if (!current.contains(cellID)) {
+            detached.push_back(cellID);
+        }
+    }
+    for (const auto cellID : detached) {
+        DropCell_(cellID);
+        changed = true;
+    }
+
+    std::vector<FormID> ids;
+    ids.reserve(current.size());
+    for (const auto cellID : current | std::views::keys) {
+        ids.push_back(cellID);
+    }
+    std::ranges::sort(ids);
+    const FormID rolling = ids.empty() ? 0 : ids[rollingCursor_++ % ids.size()];
+
+    // attached, dirtied, and the rolling revalidation
+    for (const auto cellID : ids) {
+        const auto known = cellIndex_.find(cellID);
+        if (known != cellIndex_.end() && cellID != rolling && !dirtyCells.contains(cellID)) {
+            continue;
+        }
+
+        CellEntries fresh;
+        ScanCell_(current.at(cellID), indexedBases_, fresh);
 
-        cell->ForEachReference(callback);
+        if (known != cellIndex_.end()) {
+            const bool same = std::ranges::equal(known->second, fresh, [](const auto& a, const auto& b) {
+                return a.first == b.first && a.second.refid == b.second.refid && a.second.pos == b.second.pos;
+            });
+            if (same) {
+                continue;
+            }
+            DropCell_(cellID);
+        }
+        for (const auto& e : fresh | std::views::values) {
+            refCell_[e.refid] = cellID;
+        }
+        cellIndex_[cellID] = std::move(fresh);
+        changed = true;
     }
+
+    return changed;
 }
 
 void CellScanner::RunScanTaskOnGameThread_(const WorkItemPtr& work) {
@@ -177,11 +300,172 @@ void CellScanner::RunScanTaskOnGameThread_(const WorkItemPtr& work) {
     std::unordered_set<RE::TESObjectCELL*> cellsToScan;
     CollectCellsToScan_(*work->refInfos, cellsToScan);
 
-    ScanCells_(cellsToScan, *work->bases, *work->next);
+    const auto& bases = *work->bases;
+    bool changed = UpdateIndex_(cellsToScan, bases);
+    changed |= forcePublish_.exchange(false, std::memory_order_acq_rel);
+    changed |= bases != publishedBases_;
+    if (!changed) {
+        // same layout as the published cache
+        return;
+    }
 
     if (IsStale_(work->gen)) {
+        // the index is current but nothing was published from it
+        forcePublish_.store(true, std::memory_order_release);
         return;
     }
 
-    Publish_(std::move(work->next));
-}
\ No newline at end of file
+    auto& next = *work->next;
+    for (const auto& entries : cellIndex_ | std::views::values) {
+        for (const auto& [baseID, e] : entries) {
+            if (!bases.contains(baseID)) {
+                continue;
+            }
+            next.byBase[baseID].entries.push_back(e);
+            next.fingerprint += FingerprintEntry_(baseID, e);
+        }
+    }
+    for (auto& index : next.byBase | std::views::values) {
+        index.Build(Settings::search_radius);
+    }
+
+    if (Publish_(std::move(work->next))) {
+        publishedBases_ = bases;
+    } else {
+        forcePublish_.store(true, std::memory_order_release);
+    }
+}
+
+std::int32_t CellScanner::BaseIndex::CellCoord_(const float v) const {
+    return static_cast<std::int32_t>(std::floor(v / cellSize));
+}
+
+std::uint64_t CellScanner::BaseIndex::PackCell_(const std::int32_t x, const std::int32_t y, const std::int32_t z) {
+    // 21 bits per axis: far more cells than a worldspace has at any sane search radius
+    constexpr std::uint64_t mask = (1ull << 21) - 1;
+    return (static_cast<std::uint64_t>(x) & mask) << 42 | (static_cast<std::uint64_t>(y) & mask) << 21 |
+           (static_cast<std::uint64_t>(z) & mask);
+}
+
+void CellScanner::BaseIndex::Build(const float a_cellSize) {
+    cells.clear();
+    cellSize = a_cellSize;
+    if (cellSize > 0.f && entries.size() > linear_max) {
+        auto key_of = [this](const Entry& e) {
+            return PackCell_(CellCoord_(e.pos.x), CellCoord_(e.pos.y), CellCoord_(e.pos.z));
+        };
+        std::ranges::sort(entries, {}, key_of);
+
+        for (std::uint32_t first = 0; first < entries.size();) {
+            const auto key = key_of(entries[first]);
+            std::uint32_t last = first + 1;
+            while (last < entries.size() && key_of(entries[last]) == key) {
+                ++last;
+            }
+            cells.emplace(key, std::make_pair(first, last));
+            first = last;
+        }
+    }
+
+    xs.resize(entries.size());
+    ys.resize(entries.size());
+    zs.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        xs[i] = entries[i].pos.x;
+        ys[i] = entries[i].pos.y;
+        zs[i] = entries[i].pos.z;
+    }
+}
+
+void CellScanner::BaseIndex::FilterRange_(const RE::NiPoint3& origin, const float r2, std::uint32_t first,
+                                          const std::uint32_t last, std::vector<Hit>& out) const {
+    // lanes within r2 -> hits, lowest index first
+    auto emit = [&](const std::uint32_t base, unsigned mask, const float* d2) {
+        while (mask) {
+            const auto lane = std::countr_zero(mask);
+            out.push_back({d2[lane], &entries[base + lane]});
+            mask &= mask - 1;
+        }
+    };
+
+    #ifdef __AVX2__
+    {
+        const __m256 ox = _mm256_set1_ps(origin.x);
+        const __m256 oy = _mm256_set1_ps(origin.y);
+        const __m256 oz = _mm256_set1_ps(origin.z);
+        const __m256 lim = _mm256_set1_ps(r2);
+        alignas(32) float d2[8];
+        for (; first + 8 <= last; first += 8) {
+            const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(&xs[first]), ox);
+            const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(&ys[first]), oy);
+            const __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(&zs[first]), oz);
+            const __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)),
+                                           _mm256_mul_ps(dz, dz));
+            if (const auto mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(d, lim, _CMP_LE_OQ)))) {
+                _mm256_store_ps(d2, d);
+                emit(first, mask, d2);
+            }
+        }
+    }
+    #endif
+
+    {
+        const __m128 ox = _mm_set1_ps(origin.x);
+        const __m128 oy = _mm_set1_ps(origin.y);
+        const __m128 oz = _mm_set1_ps(origin.z);
+        const __m128 lim = _mm_set1_ps(r2);
+        alignas(16) float d2[4];
+        for (; first + 4 <= last; first += 4) {
+            const __m128 dx = _mm_sub_ps(_mm_loadu_ps(&xs[first]), ox);
+            const __m128 dy = _mm_sub_ps(_mm_loadu_ps(&ys[first]), oy);
+            const __m128 dz = _mm_sub_ps(_mm_loadu_ps(&zs[first]), oz);
+            const __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+            if (const auto mask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(d, lim)))) {
+                _mm_store_ps(d2, d);
+                emit(first, mask, d2);
+            }
+        }
+    }
+
+    for (; first < last; ++first) {
+        const float dx = xs[first] - origin.x;
+        const float dy = ys[first] - origin.y;
+        const float dz = zs[first] - origin.z;
+        if (const float d2 = dx * dx + dy * dy + dz * dz; d2 <= r2) {
+            out.push_back({d2, &entries[first]});
+        }
+    }
+}
+
+void CellScanner::BaseIndex::QueryNearest(const RE::NiPoint3& origin, const float radius,
+                                          std::vector<Hit>& out) const {
+    out.clear();
+    const float r2 = radius > 0.f ? radius * radius : std::numeric_limits<float>::infinity();
+
+    bool scanned = false;
+    if (!cells.empty() && radius > 0.f) {
+        const std::int32_t x0 = CellCoord_(origin.x - radius), x1 = CellCoord_(origin.x + radius);
+        const std::int32_t y0 = CellCoord_(origin.y - radius), y1 = CellCoord_(origin.y + radius);
+        const std::int32_t z0 = CellCoord_(origin.z - radius), z1 = CellCoord_(origin.z + radius);
+        const auto n_cells = static_cast<std::uint64_t>(x1 - x0 + 1) * static_cast<std::uint64_t>(y1 - y0 + 1) *
+                             static_cast<std::uint64_t>(z1 - z0 + 1);
+        // a radius much larger than the cell size would probe more cells than there are occupied ones
+        if (n_cells <= cells.size()) {
+            for (std::int32_t x = x0; x <= x1; ++x) {
+                for (std::int32_t y = y0; y <= y1; ++y) {
+                    for (std::int32_t z = z0; z <= z1; ++z) {
+                        if (const auto it = cells.find(PackCell_(x, y, z)); it != cells.end()) {
+                            FilterRange_(origin, r2, it->second.first, it->second.second, out);
+                        }
+                    }
+                }
+            }
+            scanned = true;
+        }
+    }
+    if (!scanned) {
+        FilterRange_(origin, r2, 0, static_cast<std::uint32_t>(entries.size()), out);
+    }
+
+    std::ranges::sort(out, {}, &Hit::d2);
+}
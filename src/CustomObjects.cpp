@@ -619,6 +619,13 @@ void RefStop::Update(const RefStop& other) {
     }
 }
 
+bool RefStop::FeaturesApplied() const {
+    for (const auto& feature : {features.tint_color, features.art_object, features.effect_shader, features.sound}) {
+        if (feature.id && !feature.enabled) return false;
+    }
+    return true;
+}
+
 void SoundHelper::DeleteHandle(const RefID refid) {
     std::unique_lock lock(mutex);
     const auto it = handles.find(refid);
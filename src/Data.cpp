@@ -4,6 +4,7 @@
 #include "CLibUtilsQTR/BoundingBox.hpp"
 #include "MCP.h"
 #include "Manager.h"
+#include "Profiler.h"
 
 void Source::Init(const DefaultSettings* defaultsettings) {
     if (!defaultsettings) {
@@ -118,6 +119,7 @@ RE::TESBoundObject* Source::GetBoundObject() const {
 }
 
 std::vector<StageUpdate> Source::UpdateAllStages(RefID a_refID, const float time) {
+    AOT_PROFILE_SCOPE("Source::UpdateAllStages");
     if (init_failed) {
         logger::critical("UpdateAllStages: Initialisation failed.");
         return {};
@@ -132,31 +134,89 @@ std::vector<StageUpdate> Source::UpdateAllStages(RefID a_refID, const float time
         logger::warn("RefID {} not found in data.", a_refID);
         return updated_instances;
     }
-    for (auto& instances = data.at(a_refID); auto& instance : instances) {
+    auto& instances = data.at(a_refID);
+    for (uint32_t i = 0; i < instances.size(); ++i) {
+        auto& instance = instances[i];
+        const auto indexed = IndexedStateOf(instance);
         const Stage* old_stage = IsStageNo(instance.no) ? &GetStage(instance.no) : nullptr;
-        if (UpdateStageInstance(instance, time)) {
-            const Stage* new_stage = nullptr;
-            if (instance.xtra.is_transforming) {
-                instance.xtra.is_decayed = true;
-                instance.xtra.is_fake = false;
-                const auto temp_formid = instance.GetDelayerFormID();
-                if (!transformed_stages.contains(temp_formid)) {
-                    logger::error("Transformed stage not found.");
-                    continue;
-                }
-                new_stage = &transformed_stages.at(temp_formid);
-                instance.xtra.is_transforming = false;
-            } else if (instance.xtra.is_decayed || !IsStageNo(instance.no)) {
-                new_stage = &decayed_stage;
-            }
-            auto is_fake_ = IsFakeStage(instance.no);
-            updated_instances.emplace_back(old_stage, new_stage ? new_stage : &GetStage(instance.no),
-                                           instance.count, instance.start_time, is_fake_);
+        if (const Stage* new_stage = AdvanceInstance(instance, time)) {
+            updated_instances.emplace_back(old_stage, new_stage, instance.count, instance.start_time,
+                                           IsFakeStage(instance.no));
+            ReindexSlot(a_refID, i, indexed);
         }
     }
     return updated_instances;
 }
 
+std::vector<StageUpdate> Source::FastForwardInventory(const RefInfo& a_info, const float curr_time,
+                                                      const InvMap& inv) {
+    AOT_PROFILE_SCOPE("Source::FastForwardInventory");
+    if (init_failed) {
+        logger::critical("FastForwardInventory: Initialisation failed.");
+        return {};
+    }
+
+    std::vector<StageUpdate> updated_instances;
+    const auto it = data.find(a_info.ref_id);
+    if (it == data.end()) {
+        return updated_instances;
+    }
+
+    for (uint32_t i = 0; i < it->second.size(); ++i) {
+        auto& instance = it->second[i];
+        if (instance.count <= 0 || instance.xtra.is_decayed) continue;
+
+        const auto indexed = IndexedStateOf(instance);
+        const Stage* old_stage = IsStageNo(instance.no) ? &GetStage(instance.no) : nullptr;
+        const Stage* new_stage = nullptr;
+
+        // Hop from boundary to boundary of this instance only. Between two boundaries the elapsed time is linear
+        // in t, so the hitting time is exact; at each boundary the inventory modulator is re-picked for the new
+        // stage, which is what the stepwise loop does with a full pass over the location.
+        for (size_t n_boundaries = 0; n_boundaries <= max_catch_up_boundaries; ++n_boundaries) {
+            const float hit_t = GetNextUpdateTime(&instance);
+            if (hit_t <= 0.f || !std::isfinite(hit_t)) break;
+            const float t = std::nextafterf(hit_t, std::numeric_limits<float>::infinity());
+            if (t >= curr_time) break;
+
+            const Stage* landed = AdvanceInstance(instance, t);
+            if (!landed) break;
+            new_stage = landed;
+            if (instance.xtra.is_decayed) break;
+
+            SetDelayOfInstance(instance, t, a_info.base_id, inv);
+        }
+
+        // stage hops that came back to the same form still flip decayed/transform flags
+        if (new_stage) ReindexSlot(a_info.ref_id, i, indexed);
+        if (!new_stage || (old_stage && old_stage->formid == new_stage->formid)) continue;
+        updated_instances.emplace_back(old_stage, new_stage, instance.count, instance.start_time,
+                                       IsFakeStage(instance.no));
+    }
+
+    return updated_instances;
+}
+
+const Stage* Source::AdvanceInstance(StageInstance& instance, const float time) {
+    if (!UpdateStageInstance(instance, time)) {
+        return nullptr;
+    }
+    if (instance.xtra.is_transforming) {
+        instance.xtra.is_decayed = true;
+        instance.xtra.is_fake = false;
+        const auto temp_formid = instance.GetDelayerFormID();
+        if (!transformed_stages.contains(temp_formid)) {
+            logger::error("Transformed stage not found.");
+            return nullptr;
+        }
+        instance.xtra.is_transforming = false;
+        return &transformed_stages.at(temp_formid);
+    }
+    if (instance.xtra.is_decayed || !IsStageNo(instance.no)) {
+        return &decayed_stage;
+    }
+    return &GetStage(instance.no);
+}
 
 bool Source::IsStage(const FormID some_formid) const {
     return std::ranges::any_of(stages | std::views::values, [&](const auto& stage) {
@@ -172,6 +232,10 @@ inline bool Source::IsFakeStage(const StageNo no) const {
     return fake_stages.contains(no);
 }
 
+bool Source::HasUnfetchedFakeStage() const {
+    return std::ranges::any_of(fake_stages, [this](const StageNo no) { return !stages.contains(no); });
+}
+
 StageNo Source::GetStageNo(const FormID formid_) const {
     for (auto& [key, value] : stages) {
         if (value.formid == formid_) return key;
@@ -257,17 +321,15 @@ StageInstance* Source::InsertNewInstance(const StageInstance& stage_instance, co
         return nullptr;
     }
 
-    if (!data.contains(loc)) {
-        data[loc] = {};
-    }
-
-    data.at(loc).push_back(stage_instance);
+    auto& instances = data[loc];
+    instances.push_back(stage_instance);
+    IndexInstance(stage_index[loc], instances.back(), static_cast<uint32_t>(instances.size() - 1));
 
     // fillout the xtra of the emplaced instance
     // get the emplaced instance
     /*auto& emplaced_instance = data.back();
     emplaced_instance.xtra.form_id = stages[n].formid;
-    emplaced_instance.xtra.editor_id = clib_util::editorID::get_editorID(stages[n].GetBound());
+    emplaced_instance.xtra.editor_id = Utils::Types::InternEditorID(stages[n].GetBound());
     emplaced_instance.xtra.crafting_allowed = stages[n].crafting_allowed;
     if (IsFakeStage(n)) emplaced_instance.xtra.is_fake = true;*/
 
@@ -287,7 +349,7 @@ StageInstance* Source::InitInsertInstanceWO(StageNo n, const Count c, const RefI
     }
     StageInstance new_instance(t_0, n, c);
     new_instance.xtra.form_id = GetStage(n).formid;
-    new_instance.xtra.editor_id = clib_util::editorID::get_editorID(GetStage(n).GetBound());
+    new_instance.xtra.editor_id = Utils::Types::InternEditorID(GetStage(n).GetBound());
     new_instance.xtra.crafting_allowed = GetStage(n).crafting_allowed;
     if (IsFakeStage(n)) new_instance.xtra.is_fake = true;
 
@@ -331,10 +393,13 @@ bool Source::MoveInstance(const RefID from_ref, const RefID to_ref, const StageI
     const size_t idx = static_cast<size_t>(st_inst - base);
 
     StageInstance moved = from_instances[idx];
+    UnindexSlot(from_ref, static_cast<uint32_t>(idx));
     from_instances.erase(from_instances.begin() + idx);
 
     if (to_ref > 0) {
-        data[to_ref].push_back(std::move(moved));
+        auto& to_instances = data[to_ref];
+        to_instances.push_back(std::move(moved));
+        IndexInstance(stage_index[to_ref], to_instances.back(), static_cast<uint32_t>(to_instances.size() - 1));
     } else {
         M->InstanceCountUpdate(-1);
     }
@@ -349,10 +414,13 @@ bool Source::MoveInstanceAt(const RefID from_ref, const RefID to_ref, const size
     if (index >= from_instances.size()) return false;
 
     StageInstance moved = from_instances[index];
+    UnindexSlot(from_ref, static_cast<uint32_t>(index));
     from_instances.erase(from_instances.begin() + static_cast<std::ptrdiff_t>(index));
 
     if (to_ref > 0) {
-        data[to_ref].push_back(std::move(moved));
+        auto& to_instances = data[to_ref];
+        to_instances.push_back(std::move(moved));
+        IndexInstance(stage_index[to_ref], to_instances.back(), static_cast<uint32_t>(to_instances.size() - 1));
     } else {
         M->InstanceCountUpdate(-1);
     }
@@ -362,6 +430,7 @@ bool Source::MoveInstanceAt(const RefID from_ref, const RefID to_ref, const size
 
 Count Source::MoveInstances(const RefID from_ref, const RefID to_ref, const FormID instance_formid, Count count,
                             const bool older_first) {
+    AOT_PROFILE_SCOPE("Source::MoveInstances");
     // older_first: true to move older instances first
     if (data.empty()) {
         logger::warn("No data found for source {}", editorid);
@@ -389,73 +458,110 @@ Count Source::MoveInstances(const RefID from_ref, const RefID to_ref, const Form
         return count;
     }
 
-    std::vector<size_t> instances_candidates = {};
-    size_t index_ = 0;
-    for (const auto& st_inst : data.at(from_ref)) {
-        if (st_inst.xtra.form_id == instance_formid && st_inst.count > 0) {
-            instances_candidates.push_back(index_);
+    auto& from_instances = data.at(from_ref);
+
+    // candidates with their sort key computed once
+    struct Candidate {
+        float elapsed;
+        Count count;
+        size_t index;
+    };
+
+    std::vector<Candidate> candidates;
+    Count available = 0;
+    const auto curr_time = RE::Calendar::GetSingleton()->GetHoursPassed();
+    if (const auto slots = FindStageSlots(from_ref, instance_formid)) {
+        candidates.reserve(slots->slots.size());
+        for (const auto i : slots->slots) {
+            const auto& st_inst = from_instances[i];
+            candidates.push_back({st_inst.GetElapsed(curr_time), st_inst.count, i});
+            available += st_inst.count;
         }
-        index_++;
     }
 
-    if (instances_candidates.empty()) {
+    if (candidates.empty()) {
         logger::info("No instances found for formid {:x} and location {:x}", instance_formid, from_ref);
         return count;
     }
 
-    const auto curr_time = RE::Calendar::GetSingleton()->GetHoursPassed();
-    if (older_first) {
-        std::ranges::sort(instances_candidates,
-                          [this, from_ref, curr_time](const size_t a, const size_t b) {
-                              return this->data.at(from_ref)[a].GetElapsed(curr_time) >
-                                     this->data.at(from_ref)[b].GetElapsed(curr_time); // move the older stuff
-                          });
-    } else {
-        std::ranges::sort(instances_candidates,
-                          [this, from_ref, curr_time](const size_t a, const size_t b) {
-                              return this->data.at(from_ref)[a].GetElapsed(curr_time) <
-                                     this->data.at(from_ref)[b].GetElapsed(curr_time); // move the newer stuff
-                          });
-    }
-
-    std::vector<size_t> removed_indices;
-    for (size_t index : instances_candidates) {
-        if (!count) break;
-
-        StageInstance* instance;
-        if (removed_indices.empty()) {
-            instance = &data.at(from_ref)[index];
-        } else {
-            int shift = 0;
-            for (const size_t removed_index : removed_indices) {
-                if (index == removed_index) {
-                    logger::critical("Index is equal to removed index.");
-                    return count;
-                }
-                if (index > removed_index) shift++;
+    // Taking everything needs no ordering. Otherwise the candidates are only partitioned around the one that
+    // completes count (nth_element weighted by count): the older (or newer) ones ahead of it are moved whole, in any
+    // order, and it is moved last, split if needed. Expected linear, where sorting the stack was n log n.
+    size_t n_take = candidates.size();
+    if (available > count) {
+        const auto before = [older_first](const Candidate& a, const Candidate& b) {
+            return older_first ? a.elapsed > b.elapsed : a.elapsed < b.elapsed;
+        };
+        // [lo, hi) always holds at least `need` more
+        size_t lo = 0;
+        size_t hi = candidates.size();
+        Count need = count;
+        while (true) {
+            const auto mid = lo + (hi - lo) / 2;
+            const auto first = candidates.begin();
+            std::ranges::nth_element(first + static_cast<std::ptrdiff_t>(lo), first + static_cast<std::ptrdiff_t>(mid),
+                                     first + static_cast<std::ptrdiff_t>(hi), before);
+            Count ahead = 0;
+            for (size_t i = lo; i < mid; ++i) ahead += candidates[i].count;
+            if (ahead >= need) {
+                hi = mid;
+            } else if (ahead + candidates[mid].count >= need) {
+                n_take = mid + 1;
+                break;
+            } else {
+                need -= ahead + candidates[mid].count;
+                lo = mid + 1;
             }
-            instance = &data.at(from_ref)[index - shift];
         }
+    }
 
-        if (count <= instance->count) {
-            instance->count -= count;
-            StageInstance new_instance(*instance);
-            new_instance.count = count;
-            if (to_ref > 0 && !InsertNewInstance(new_instance, to_ref)) {
-                logger::error("InsertNewInstance failed.");
-                return 0;
-            }
+    // Whole instances are moved in one pass; at most one instance is split.
+    std::vector<char> moved(from_instances.size(), 0);
+    // created on the first whole move, so a move that only splits leaves no empty entry behind
+    std::vector<StageInstance>* to_instances = nullptr;
+    std::optional<StageInstance> split;
+    int32_t n_moved = 0;
+    for (size_t c = 0; c < n_take && count; ++c) {
+        const auto index = candidates[c].index;
+        auto& instance = from_instances[index];
+        if (count < instance.count) {
+            const auto indexed = IndexedStateOf(instance);
+            instance.count -= count;
+            ReindexSlot(from_ref, static_cast<uint32_t>(index), indexed);
+            split.emplace(instance);
+            split->count = count;
             count = 0;
-        } else {
-            const auto count_temp = count;
-            count -= instance->count;
-            if (!MoveInstance(from_ref, to_ref, instance)) {
-                logger::error("MoveInstance failed.");
-                return count_temp;
-            }
-            removed_indices.push_back(index);
+            break;
+        }
+        count -= instance.count;
+        moved[index] = 1;
+        ++n_moved;
+        if (to_ref > 0) {
+            if (!to_instances) to_instances = &data[to_ref];
+            to_instances->push_back(instance);
+            IndexInstance(stage_index[to_ref], to_instances->back(), static_cast<uint32_t>(to_instances->size() - 1));
         }
     }
+
+    if (n_moved) {
+        UnindexSlots(from_ref, moved);
+        size_t kept = 0;
+        for (size_t i = 0; i < from_instances.size(); ++i) {
+            if (moved[i]) continue;
+            if (kept != i) from_instances[kept] = from_instances[i];
+            ++kept;
+        }
+        from_instances.erase(from_instances.begin() + static_cast<std::ptrdiff_t>(kept), from_instances.end());
+        if (to_ref <= 0) {
+            M->InstanceCountUpdate(-n_moved);
+        }
+    }
+
+    if (split && to_ref > 0 && !InsertNewInstance(*split, to_ref)) {
+        logger::error("InsertNewInstance failed.");
+        return 0;
+    }
+
     return count;
 }
 
@@ -504,11 +610,46 @@ inline FormID Source::GetTransformerInWorld(const RE::TESObjectREFR* wo, const S
     return 0;
 }
 
-void Source::UpdateTimeModulationInWorld(RE::TESObjectREFR* wo, StageInstance& wo_inst, const float _time) const {
-    SetDelayOfInstance(wo_inst, _time, wo);
+void Source::CollectWorldCandidates(const StageNo a_no, std::vector<FormID>& a_transformers,
+                                    std::vector<FormID>& a_delayers) const {
+    for (const auto& trns_fid : settings.transformers_order) {
+        if (settings.transformer_allowed_stages.at(trns_fid).contains(a_no)) {
+            a_transformers.push_back(trns_fid);
+        }
+    }
+    for (const auto& dlyr_fid : settings.delayers_order) {
+        if (settings.delayer_allowed_stages.at(dlyr_fid).contains(a_no)) {
+            a_delayers.push_back(dlyr_fid);
+        }
+    }
+}
+
+void Source::UpdateTimeModulationInWorld(RE::TESObjectREFR* wo, StageInstance& wo_inst, const float _time,
+                                         const WorldModulation* a_resolved) const {
+    // the batch resolved it for whatever stage the object was at; fall back if it evolved since
+    if (!a_resolved || a_resolved->source != formid || a_resolved->no != wo_inst.no) {
+        SetDelayOfInstance(wo_inst, _time, wo);
+        return;
+    }
+
+    if (wo_inst.count <= 0) return;
+    if (ShouldFreezeEvolution(wo->GetBaseObject()->GetFormID())) {
+        wo_inst.RemoveTimeMod(_time);
+        wo_inst.SetDelay(_time, 0, 0); // freeze
+        return;
+    }
+
+    if (a_resolved->transformer) {
+        SetDelayOfInstance(wo_inst, _time, a_resolved->transformer);
+    } else if (a_resolved->delayer) {
+        SetDelayOfInstance(wo_inst, _time, a_resolved->delayer);
+    } else {
+        wo_inst.RemoveTimeMod(_time);
+    }
 }
 
 float Source::GetNextUpdateTime(const StageInstance* st_inst) {
+    AOT_PROFILE_SCOPE("Source::GetNextUpdateTime");
     if (!st_inst) {
         logger::error("Stage instance is null.");
         return 0;
@@ -603,6 +744,7 @@ void Source::UpdateTimeModulationInInventory(const RefInfo& a_info, const float
 
 
 float Source::GetNextUpdateTime(const StageInstance* st_inst) const {
+    AOT_PROFILE_SCOPE("Source::GetNextUpdateTime const");
     if (!st_inst) {
         logger::error("Stage instance is null.");
         return 0;
@@ -636,7 +778,338 @@ float Source::GetNextUpdateTime(const StageInstance* st_inst) const {
     return st_inst->GetHittingTime(schranke);
 }
 
+void Source::IndexInstance(LocationStageIndex& index, const StageInstance& st_inst, const uint32_t slot) {
+    if (st_inst.count <= 0) return;
+    auto& entry = index[st_inst.xtra.form_id];
+    // slots stay ascending; appends are the common case
+    if (entry.slots.empty() || entry.slots.back() < slot) {
+        entry.slots.push_back(slot);
+    } else {
+        entry.slots.insert(std::ranges::lower_bound(entry.slots, slot), slot);
+    }
+    if (st_inst.xtra.is_decayed) return;
+    entry.total += st_inst.count;
+    entry.has_fake = entry.has_fake || st_inst.xtra.is_fake;
+}
+
+void Source::UnindexInstance(LocationStageIndex& index, const IndexedState& state, const uint32_t slot,
+                             const std::vector<StageInstance>& instances) {
+    const auto it = index.find(state.form_id);
+    if (it == index.end()) return;
+    auto& entry = it->second;
+    const auto sit = std::ranges::lower_bound(entry.slots, slot);
+    if (sit == entry.slots.end() || *sit != slot) return;
+    entry.slots.erase(sit);
+    if (entry.slots.empty()) {
+        index.erase(it);
+        return;
+    }
+    if (state.is_decayed) return;
+    entry.total -= state.count;
+    if (state.is_fake) {
+        entry.has_fake = std::ranges::any_of(entry.slots, [&](const uint32_t i) {
+            return instances[i].xtra.is_fake && !instances[i].xtra.is_decayed;
+        });
+    }
+}
+
+void Source::ReindexSlot(const RefID loc, const uint32_t slot, const IndexedState& before) {
+    const auto it = data.find(loc);
+    if (it == data.end() || slot >= it->second.size()) return;
+    const auto& st_inst = it->second[slot];
+    if (IndexedStateOf(st_inst) == before) return;
+    auto& index = stage_index[loc];
+    UnindexInstance(index, before, slot, it->second);
+    IndexInstance(index, st_inst, slot);
+    if (index.empty()) stage_index.erase(loc);
+}
+
+void Source::UnindexSlot(const RefID loc, const uint32_t slot) {
+    const auto dit = data.find(loc);
+    const auto iit = stage_index.find(loc);
+    if (dit == data.end() || iit == stage_index.end() || slot >= dit->second.size()) return;
+    auto& index = iit->second;
+    UnindexInstance(index, IndexedStateOf(dit->second[slot]), slot, dit->second);
+    for (auto& entry : index | std::views::values) {
+        for (auto& i : entry.slots) {
+            if (i > slot) --i;
+        }
+    }
+    if (index.empty()) stage_index.erase(iit);
+}
+
+void Source::UnindexSlots(const RefID loc, const std::vector<char>& erased) {
+    const auto dit = data.find(loc);
+    const auto iit = stage_index.find(loc);
+    if (dit == data.end() || iit == stage_index.end()) return;
+    const auto& instances = dit->second;
+    auto& index = iit->second;
+
+    const auto is_erased = [&erased](const uint32_t i) { return i < erased.size() && erased[i]; };
+
+    // new slot of every kept instance
+    std::vector<uint32_t> shifted(instances.size());
+    uint32_t n_erased = 0;
+    for (uint32_t i = 0; i < instances.size(); ++i) {
+        shifted[i] = i - n_erased;
+        if (is_erased(i)) ++n_erased;
+    }
+    if (!n_erased) return;
+
+    // one sweep per stage form; erasing the slots one at a time is quadratic on large stacks
+    for (auto it = index.begin(); it != index.end();) {
+        auto& entry = it->second;
+        bool lost_fake = false;
+        std::erase_if(entry.slots, [&](const uint32_t i) {
+            if (!is_erased(i)) return false;
+            if (const auto& st_inst = instances[i]; !st_inst.xtra.is_decayed) {
+                entry.total -= st_inst.count;
+                lost_fake = lost_fake || st_inst.xtra.is_fake;
+            }
+            return true;
+        });
+        if (entry.slots.empty()) {
+            it = index.erase(it);
+            continue;
+        }
+        if (lost_fake) {
+            entry.has_fake = std::ranges::any_of(entry.slots, [&](const uint32_t i) {
+                return instances[i].xtra.is_fake && !instances[i].xtra.is_decayed;
+            });
+        }
+        for (auto& i : entry.slots) i = shifted[i];
+        ++it;
+    }
+    if (index.empty()) stage_index.erase(iit);
+}
+
+void Source::ReindexLocation(const RefID loc) {
+    const auto it = data.find(loc);
+    if (it == data.end() || it->second.empty()) {
+        stage_index.erase(loc);
+        return;
+    }
+    auto& index = stage_index[loc];
+    index.clear();
+    for (uint32_t i = 0; i < it->second.size(); ++i) {
+        IndexInstance(index, it->second[i], i);
+    }
+    if (index.empty()) stage_index.erase(loc);
+}
+
+const Source::LocationStageIndex* Source::GetStageIndex(const RefID loc) const {
+    const auto it = stage_index.find(loc);
+    return it != stage_index.end() ? &it->second : nullptr;
+}
+
+const Source::StageSlots* Source::FindStageSlots(const RefID loc, const FormID stage_formid) const {
+    const auto index = GetStageIndex(loc);
+    if (!index) return nullptr;
+    const auto it = index->find(stage_formid);
+    return it != index->end() ? &it->second : nullptr;
+}
+
+StageRow Source::ProjectRow(const StageInstance& st_inst, const RefID loc, const float curr_time) const {
+    StageRow row;
+    row.location = loc;
+    row.source_formid = formid;
+    row.form_id = st_inst.xtra.form_id;
+    row.no = st_inst.no;
+    while (IsStageNo(row.max_no + 1)) row.max_no++;
+    row.count = st_inst.count;
+    row.start_time = st_inst.start_time;
+    row.duration = GetStageDuration(st_inst.no);
+    row.slope = st_inst.GetDelaySlope();
+    row.delay_magnitude = st_inst.GetDelayMagnitude();
+    row.delayer = st_inst.GetDelayerFormID();
+    const auto delayer_it = settings.delayers.find(row.delayer);
+    row.delayer_multiplier = delayer_it != settings.delayers.end() ? delayer_it->second : row.slope;
+    row.is_fake = st_inst.xtra.is_fake;
+    row.is_transforming = st_inst.xtra.is_transforming;
+    row.is_decayed = st_inst.xtra.is_decayed;
+    if (const auto it = stages.find(st_inst.no); it != stages.end()) row.name = it->second.name;
+
+    row.evaluated_at = curr_time;
+    if (!IsHealthy()) return row;
+
+    if (std::abs(row.slope) >= EPSILON) {
+        row.next_update_time = GetNextUpdateTime(&st_inst);
+    }
+
+    if (row.is_transforming) {
+        row.direction = StageRow::Direction::kTransform;
+        if (const auto it = settings.transformers.find(row.delayer); it != settings.transformers.end()) {
+            row.next_formid = it->second.first;
+            if (const auto total = it->second.second; total > 0.f) {
+                row.has_progress = true;
+                row.progress_origin = st_inst.GetTransformElapsed(curr_time) / total;
+                row.progress_rate = row.slope / total;
+            }
+        }
+        return row;
+    }
+
+    if (IsStageNo(st_inst.no) && row.duration > 0.f) {
+        row.has_progress = true;
+        row.progress_origin = st_inst.GetElapsed(curr_time) / row.duration;
+        row.progress_rate = row.slope / row.duration;
+    }
+
+    if (std::abs(row.slope) < EPSILON) return row;
+
+    if (row.slope > 0.f) {
+        row.direction = StageRow::Direction::kForward;
+        if (IsStageNo(st_inst.no + 1)) {
+            row.next_is_stage = true;
+            row.next_no = st_inst.no + 1;
+        } else {
+            row.next_formid = settings.decayed_id;
+        }
+    } else {
+        row.direction = StageRow::Direction::kBackward;
+        if (st_inst.no > 0 && IsStageNo(st_inst.no - 1)) {
+            row.next_is_stage = true;
+            row.next_no = st_inst.no - 1;
+        }
+    }
+    if (row.next_is_stage) {
+        if (const auto it = stages.find(row.next_no); it != stages.end()) {
+            row.next_formid = it->second.formid;
+            row.next_name = it->second.name;
+        }
+    }
+    return row;
+}
+
+SourceSummary Source::Summarize() const {
+    SourceSummary summary;
+    summary.formid = formid;
+    StageNo no = 0;
+    for (; IsStageNo(no); ++no) {
+        if (const auto* stage = TryGetStage(no)) {
+            summary.stages.push_back({no, stage->formid, stage->name, stage->duration, IsFakeStage(no),
+                                      stage->crafting_allowed});
+        }
+    }
+    summary.decayed = {no, decayed_stage.formid, "Final", 0.f, IsFakeStage(no), decayed_stage.crafting_allowed};
+    summary.containers.assign(settings.containers.begin(), settings.containers.end());
+    summary.transformers.assign(settings.transformers.begin(), settings.transformers.end());
+    summary.delayers.assign(settings.delayers.begin(), settings.delayers.end());
+    return summary;
+}
+
+void Source::MergeAlmostSame(std::vector<StageInstance>& instances, const float curr_time) {
+    if (instances.size() < 2) return;
+
+    // Only instances with the same form, stage and delay state can be AlmostSameExceptCount. Sort their indices so
+    // that each such bucket is contiguous and ordered by start time, then sweep every bucket once.
+    struct Key {
+        FormID form_id;
+        StageNo no;
+        bool is_transforming;
+        FormID delayer;
+        float start_time;
+        float elapsed;
+        size_t index;
+    };
+
+    std::vector<Key> keys;
+    keys.reserve(instances.size());
+    for (size_t i = 0; i < instances.size(); ++i) {
+        const auto& inst = instances[i];
+        if (inst.count <= 0) continue;
+        keys.push_back({inst.xtra.form_id, inst.no, inst.xtra.is_transforming, inst.GetDelayerFormID(),
+                        inst.start_time, inst.GetElapsed(curr_time), i});
+    }
+    if (keys.size() < 2) return;
+
+    std::ranges::sort(keys, [](const Key& a, const Key& b) {
+        return std::tie(a.form_id, a.no, a.is_transforming, a.delayer, a.start_time, a.index) <
+               std::tie(b.form_id, b.no, b.is_transforming, b.delayer, b.start_time, b.index);
+    });
+
+    const auto same_bucket = [](const Key& a, const Key& b) {
+        return a.form_id == b.form_id && a.no == b.no && a.is_transforming == b.is_transforming &&
+               a.delayer == b.delayer;
+    };
+
+    // Each member not merged yet becomes an anchor in turn and collects the later members of its bucket that are
+    // almost the same as it. The bucket is ordered by start time, so the scan ends at the first member that started
+    // too late, but members whose elapsed time differs are only skipped: they stay available to later anchors. The
+    // merged count goes to the member with the smallest index so the container keeps its order.
+    std::vector<bool> merged(keys.size(), false);
+    std::vector<size_t> run;
+    for (size_t a = 0; a < keys.size(); ++a) {
+        if (merged[a]) continue;
+        const auto& anchor = keys[a];
+        run.assign(1, a);
+        size_t keep = anchor.index;
+        for (size_t j = a + 1; j < keys.size() && same_bucket(anchor, keys[j]) &&
+                               keys[j].start_time - anchor.start_time < 0.015f; ++j) {
+            if (merged[j] || std::abs(keys[j].elapsed - anchor.elapsed) >= 0.015f) continue;
+            merged[j] = true;
+            run.push_back(j);
+            keep = std::min(keep, keys[j].index);
+        }
+        for (const auto j : run) {
+            const auto i = keys[j].index;
+            if (i == keep) continue;
+            instances[keep].count += instances[i].count;
+            instances[i].count = 0;
+        }
+    }
+}
+
+uint32_t Source::CleanUpInstances(const RefID loc, std::vector<StageInstance>& instances, const float curr_time) {
+    if (instances.empty()) return 0;
+
+    // merged-away instances keep their slots at count 0 and the merged counts stay within one index entry, so the
+    // index only has to follow the erasures below
+    MergeAlmostSame(instances, curr_time);
+
+    std::vector<char> erased(instances.size(), 0);
+    uint32_t removed = 0;
+    for (size_t i = 0; i < instances.size(); ++i) {
+        auto& inst = instances[i];
+        if (inst.count <= 0 || inst.start_time > curr_time || inst.xtra.is_decayed || !IsStageNo(inst.no)) {
+            erased[i] = 1;
+            ++removed;
+            continue;
+        }
+
+        // check if current time modulator is valid
+        const auto curr_delayer = inst.GetDelayerFormID();
+        if (inst.xtra.is_transforming) {
+            if (!settings.transformers.contains(curr_delayer)) {
+                logger::warn("Transformer FormID {:x} not found in default settings.", curr_delayer);
+                inst.RemoveTimeMod(curr_time);
+            }
+        } else if (curr_delayer != 0 && !settings.delayers.contains(curr_delayer)) {
+            logger::warn("Delayer FormID {:x} not found in default settings.", curr_delayer);
+            inst.RemoveTimeMod(curr_time);
+        }
+
+        if (curr_time - GetDecayTime(inst) > static_cast<float>(Settings::nForgettingTime)) {
+            erased[i] = 1;
+            ++removed;
+        }
+    }
+    if (!removed) return 0;
+
+    UnindexSlots(loc, erased);
+    size_t kept = 0;
+    for (size_t i = 0; i < instances.size(); ++i) {
+        if (erased[i]) continue;
+        if (kept != i) instances[kept] = std::move(instances[i]);
+        ++kept;
+    }
+    instances.erase(instances.begin() + static_cast<std::ptrdiff_t>(kept), instances.end());
+
+    return removed;
+}
+
 void Source::CleanUpData() {
+    AOT_PROFILE_SCOPE("Source::CleanUpData");
     if (!CheckIntegrity()) {
         logger::critical("CheckIntegrity failed");
         InitFailed();
@@ -654,48 +1127,8 @@ void Source::CleanUpData() {
     uint32_t removed = 0;
 
     const auto curr_time = RE::Calendar::GetSingleton()->GetHoursPassed();
-    for (auto& instances : data | std::views::values) {
-        if (instances.empty()) continue;
-        if (instances.size() > 1) {
-            for (auto it = instances.begin(); it + 1 != instances.end(); ++it) {
-                for (auto it2 = it + 1; it2 != instances.end(); ++it2) {
-                    if (it == it2) continue;
-                    if (it2->count <= 0) continue;
-                    if (it->AlmostSameExceptCount(*it2, curr_time)) {
-                        it->count += it2->count;
-                        it2->count = 0;
-                    }
-                }
-            }
-        }
-        for (auto it = instances.begin(); it != instances.end();) {
-            if (it->count <= 0 ||
-                it->start_time > curr_time ||
-                (it->xtra.is_decayed || !IsStageNo(it->no))) {
-                it = instances.erase(it);
-                ++removed;
-                continue;
-            }
-
-            //check if current time modulator is valid
-            const auto curr_delayer = it->GetDelayerFormID();
-            if (it->xtra.is_transforming) {
-                if (!settings.transformers.contains(curr_delayer)) {
-                    logger::warn("Transformer FormID {:x} not found in default settings.", curr_delayer);
-                    it->RemoveTimeMod(curr_time);
-                }
-            } else if (curr_delayer != 0 && !settings.delayers.contains(curr_delayer)) {
-                logger::warn("Delayer FormID {:x} not found in default settings.", curr_delayer);
-                it->RemoveTimeMod(curr_time);
-            }
-
-            if (curr_time - GetDecayTime(*it) > static_cast<float>(Settings::nForgettingTime)) {
-                it = instances.erase(it);
-                ++removed;
-                continue;
-            }
-            ++it;
-        }
+    for (auto& [loc, instances] : data) {
+        removed += CleanUpInstances(loc, instances, curr_time);
     }
 
     for (auto it = data.begin(); it != data.end();) {
@@ -704,12 +1137,19 @@ void Source::CleanUpData() {
         } else ++it;
     }
 
+    // full pass anyway, so validate the incremental index by rebuilding it
+    stage_index.clear();
+    for (const auto loc : data | std::views::keys) {
+        ReindexLocation(loc);
+    }
+
     if (removed) {
         M->InstanceCountUpdate(-static_cast<int32_t>(removed));
     }
 }
 
 void Source::CleanUpData(const RefID a_loc) {
+    AOT_PROFILE_SCOPE("Source::CleanUpData(loc)");
     /*if (!CheckIntegrity()) {
         logger::critical("CheckIntegrity failed");
         InitFailed();
@@ -733,46 +1173,7 @@ void Source::CleanUpData(const RefID a_loc) {
         return;
     }
 
-    uint32_t removed = 0;
-
-    if (instances.size() > 1) {
-        for (auto it = instances.begin(); it + 1 != instances.end(); ++it) {
-            for (auto it2 = it + 1; it2 != instances.end(); ++it2) {
-                if (it == it2) continue;
-                if (it2->count <= 0) continue;
-                if (it->AlmostSameExceptCount(*it2, curr_time)) {
-                    it->count += it2->count;
-                    it2->count = 0;
-                }
-            }
-        }
-    }
-    for (auto it = instances.begin(); it != instances.end();) {
-        if (it->count <= 0 || it->start_time > curr_time || (it->xtra.is_decayed || !IsStageNo(it->no))) {
-            it = instances.erase(it);
-            ++removed;
-            continue;
-        }
-
-        // check if current time modulator is valid
-        const auto curr_delayer = it->GetDelayerFormID();
-        if (it->xtra.is_transforming) {
-            if (!settings.transformers.contains(curr_delayer)) {
-                logger::warn("Transformer FormID {:x} not found in default settings.", curr_delayer);
-                it->RemoveTimeMod(curr_time);
-            }
-        } else if (curr_delayer != 0 && !settings.delayers.contains(curr_delayer)) {
-            logger::warn("Delayer FormID {:x} not found in default settings.", curr_delayer);
-            it->RemoveTimeMod(curr_time);
-        }
-
-        if (curr_time - GetDecayTime(*it) > static_cast<float>(Settings::nForgettingTime)) {
-            it = instances.erase(it);
-            ++removed;
-            continue;
-        }
-        ++it;
-    }
+    const uint32_t removed = CleanUpInstances(a_loc, instances, curr_time);
 
     if (instances.empty()) {
         data.erase(it_instances);
@@ -817,6 +1218,7 @@ void Source::Reset() {
     editorid = "";
     stages.clear();
     data.clear();
+    stage_index.clear();
     init_failed = false;
 }
 
@@ -839,7 +1241,7 @@ bool Source::UpdateStageInstanceHelper(StageInstance& st_inst, const float curr_
         const bool is_stage = IsStageNo(st_inst.no);
         const auto& new_stage = is_stage ? GetStage(st_inst.no) : decayed_stage;
         st_inst.xtra.form_id = new_stage.formid;
-        st_inst.xtra.editor_id = clib_util::editorID::get_editorID(new_stage.GetBound());
+        st_inst.xtra.editor_id = Utils::Types::InternEditorID(new_stage.GetBound());
         st_inst.xtra.is_fake = IsFakeStage(st_inst.no);
         st_inst.xtra.crafting_allowed = new_stage.crafting_allowed;
         st_inst.xtra.is_decayed = !IsStageNo(st_inst.no);
@@ -1088,7 +1490,7 @@ float Source::GetDecayTime(const StageInstance& st_inst) {
 inline void Source::InitFailed() {
     logger::error("Initialisation failed for formid {:x}.", formid);
     Reset();
-    init_failed = true;
+    init_failed.store(true, std::memory_order_release);
 }
 
 void Source::RegisterStage(const FormID stage_formid, const StageNo stage_no) {
@@ -1222,22 +1624,75 @@ namespace {
         return obb1.Intersects(obb2_in);
     }
 
-    bool SearchModulatorInCell_Sub(const RE::TESObjectREFR* a_origin, const RE::TESObjectREFR* ref,
-                                   const float proximity = Settings::proximity_range) {
-        DirectX::BoundingOrientedBox obb1{};
-        DirectX::BoundingOrientedBox obb2{};
-
-        if (const auto a_rigidbody1 = GetRigidBody(a_origin)) {
-            BoundingBox::GetOBB(a_rigidbody1, obb1);
+    DirectX::BoundingOrientedBox ComputeOBB(const RE::TESObjectREFR* a_refr) {
+        DirectX::BoundingOrientedBox obb{};
+        if (const auto a_rigidbody = GetRigidBody(a_refr)) {
+            BoundingBox::GetOBB(a_rigidbody, obb);
         } else {
-            BoundingBox::GetOBB(a_origin, obb1);
+            BoundingBox::GetOBB(a_refr, obb);
         }
-        if (const auto a_rigidbody2 = GetRigidBody(ref)) {
-            BoundingBox::GetOBB(a_rigidbody2, obb2);
-        } else {
-            BoundingBox::GetOBB(ref, obb2);
+        return obb;
+    }
+
+    // OBBs of the refs compared by SearchModulatorInCell_Sub. An entry is reused while the ref keeps the same 3D
+    // and world transform; everything is dropped when the CellScanner publishes a new cache generation.
+    // Static modulators (campfires, barrels...) are thus boxed once instead of on every comparison.
+    class OBBCache {
+    public:
+        static OBBCache& Get() {
+            static OBBCache cache;
+            return cache;
         }
 
+        DirectX::BoundingOrientedBox Fetch(const RE::TESObjectREFR* a_refr, const std::uint64_t a_generation) {
+            const auto node = a_refr->GetCurrent3D();
+            if (!node) return ComputeOBB(a_refr);
+
+            const auto refid = a_refr->GetFormID();
+            {
+                std::shared_lock lock(mutex_);
+                if (generation_ == a_generation) {
+                    if (const auto it = entries_.find(refid); it != entries_.end() && it->second.node == node &&
+                        std::memcmp(&it->second.world, &node->world, sizeof(RE::NiTransform)) == 0) {
+                        return it->second.obb;
+                    }
+                }
+            }
+
+            const auto obb = ComputeOBB(a_refr);
+            std::unique_lock lock(mutex_);
+            if (generation_ != a_generation || entries_.size() >= max_entries) {
+                entries_.clear();
+                generation_ = a_generation;
+            }
+            entries_.insert_or_assign(refid, Entry{node, node->world, obb});
+            return obb;
+        }
+
+    private:
+        // refs that go out of range are only dropped with the generation; this bounds the map in between
+        static constexpr size_t max_entries = 8192;
+
+        struct Entry {
+            const RE::NiAVObject* node;
+            RE::NiTransform world;
+            DirectX::BoundingOrientedBox obb;
+        };
+
+        std::shared_mutex mutex_;
+        // [locks: mutex_]
+        std::uint64_t generation_ = 0;
+        // [locks: mutex_]
+        std::unordered_map<RefID, Entry> entries_;
+    };
+
+    bool SearchModulatorInCell_Sub(const RE::TESObjectREFR* a_origin, const RE::TESObjectREFR* ref,
+                                   const std::uint64_t generation,
+                                   const float proximity = Settings::proximity_range) {
+        auto& obb_cache = OBBCache::Get();
+        const auto obb1 = obb_cache.Fetch(a_origin, generation);
+        const auto obb2 = obb_cache.Fetch(ref, generation);
+
         #ifndef NDEBUG
         if (UI::draw_debug) {
         }
@@ -1280,45 +1735,100 @@ FormID Source::SearchNearbyModulatorsCached(const RE::TESObjectREFR* a_obj, cons
     const auto originPos = Utils::WorldObject::GetPosition(a_obj);
 
     const float r = Settings::search_radius;
-    const float r2 = (r > 0.0f) ? (r * r) : std::numeric_limits<float>::infinity();
 
     // Respect candidate ordering (unlike your current unordered_set path).
+    thread_local std::vector<CellScanner::Hit> hits;
     for (const auto baseID : candidates) {
         const auto it = cache->byBase.find(baseID);
         if (it == cache->byBase.end()) {
             continue;
         }
 
-        // For this baseID, try the closest refs first (without sorting):
-        // we scan all within r2 and keep the best hit that passes the OBB check.
-        float bestD2 = r2;
-        bool found = false;
-
-        for (const auto& e : it->second) {
-            const float dx = e.pos.x - originPos.x;
-            const float dy = e.pos.y - originPos.y;
-            const float dz = e.pos.z - originPos.z;
-            const float d2 = dx * dx + dy * dy + dz * dz;
-
-            if (d2 > bestD2) {
-                continue;
-            }
-
-            const auto ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(e.refid);
+        // nearest first, so the first ref that passes the OBB check settles this base
+        it->second.QueryNearest(originPos, r, hits);
+        for (const auto& hit : hits) {
+            const auto ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(hit.entry->refid);
             if (!ref || ref->IsDisabled() || ref->IsDeleted() || ref->IsMarkedForDeletion()) {
                 continue;
             }
 
-            if (SearchModulatorInCell_Sub(a_obj, ref)) {
-                bestD2 = d2;
-                found = true;
+            if (SearchModulatorInCell_Sub(a_obj, ref, cache->generation)) {
+                return baseID;
             }
         }
+    }
+
+    return 0;
+}
+void Source::SearchNearbyModulatorsBatch(const std::vector<FormID>& candidates,
+                                         const std::span<const RE::TESObjectREFR* const> objs,
+                                         const std::span<FormID> a_out) {
+    if (candidates.empty() || objs.empty()) {
+        return;
+    }
 
-        if (found) {
-            return baseID;
+    const auto cache = CellScanner::GetSingleton()->GetCache();
+    if (!cache || cache->byBase.empty()) {
+        return;
+    }
+
+    const float r = Settings::search_radius;
+
+    std::vector<size_t> pending;
+    std::vector<RE::NiPoint3> origins;
+    pending.reserve(objs.size());
+    origins.reserve(objs.size());
+    for (size_t i = 0; i < objs.size(); ++i) {
+        if (objs[i] && !a_out[i]) {
+            pending.push_back(i);
+            origins.push_back(Utils::WorldObject::GetPosition(objs[i]));
         }
     }
 
-    return 0;
-}
\ No newline at end of file
+    // modulator refs are shared between the objects of the batch; look each one up once
+    std::unordered_map<RefID, const RE::TESObjectREFR*> usable;
+    auto get_usable = [&usable](const RefID refid) {
+        auto [it, inserted] = usable.try_emplace(refid, nullptr);
+        if (inserted) {
+            if (const auto ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(refid);
+                ref && !ref->IsDisabled() && !ref->IsDeleted() && !ref->IsMarkedForDeletion()) {
+                it->second = ref;
+            }
+        }
+        return it->second;
+    };
+
+    // Base by base in candidate order, so an object settled by an earlier base is dropped before the later ones,
+    // which gives the same answer as SearchNearbyModulatorsCached per object.
+    thread_local std::vector<CellScanner::Hit> hits;
+    for (const auto baseID : candidates) {
+        if (pending.empty()) break;
+        const auto it = cache->byBase.find(baseID);
+        if (it == cache->byBase.end()) {
+            continue;
+        }
+
+        size_t kept = 0;
+        for (size_t k = 0; k < pending.size(); ++k) {
+            const auto i = pending[k];
+            bool found = false;
+            it->second.QueryNearest(origins[k], r, hits);
+            for (const auto& hit : hits) {
+                const auto ref = get_usable(hit.entry->refid);
+                if (ref && SearchModulatorInCell_Sub(objs[i], ref, cache->generation)) {
+                    found = true;
+                    break;
+                }
+            }
+            if (found) {
+                a_out[i] = baseID;
+            } else {
+                pending[kept] = i;
+                origins[kept] = origins[k];
+                ++kept;
+            }
+        }
+        pending.resize(kept);
+        origins.resize(kept);
+    }
+}
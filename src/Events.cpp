@@ -1,4 +1,5 @@
 #include "Events.h"
+#include "CellScan.h"
 #include "Manager.h"
 #include "Settings.h"
 #include "Threading.h"
@@ -49,6 +50,7 @@ RE::BSEventNotifyControl EventSink::ProcessEvent(const SKSE::CrosshairRefEvent*
                                                  RE::BSTEventSource<SKSE::CrosshairRefEvent>*) {
     if (M->isLoading.load()) return RE::BSEventNotifyControl::kContinue;
     if (!event) return RE::BSEventNotifyControl::kContinue;
+    M->SetCrosshairRef(event->crosshairRef ? event->crosshairRef->GetFormID() : 0);
     if (!event->crosshairRef) return RE::BSEventNotifyControl::kContinue;
 
     if (!event->crosshairRef->HasContainer()) HandleWO(event->crosshairRef.get());
@@ -122,8 +124,17 @@ RE::BSEventNotifyControl EventSink::ProcessEvent(const RE::TESFormDeleteEvent* a
                                                  RE::BSTEventSource<RE::TESFormDeleteEvent>*) {
     if (!a_event) return RE::BSEventNotifyControl::kContinue;
     if (!a_event->formID) return RE::BSEventNotifyControl::kContinue;
+    CellScanner::GetSingleton()->MarkRefDirty(a_event->formID);
     if (M->HandleFormDelete(a_event->formID)) {
         logger::info("Form deleted: {:x}", a_event->formID);
     }
     return RE::BSEventNotifyControl::kContinue;
+}
+
+RE::BSEventNotifyControl EventSink::ProcessEvent(const RE::TESMoveAttachDetachEvent* a_event,
+                                                 RE::BSTEventSource<RE::TESMoveAttachDetachEvent>*) {
+    if (!a_event || !a_event->movedRef) return RE::BSEventNotifyControl::kContinue;
+    CellScanner::GetSingleton()->MarkRefDirty(a_event->movedRef->GetFormID());
+    M->RetierWO(a_event->movedRef.get());
+    return RE::BSEventNotifyControl::kContinue;
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "CLibUtilsQTR/DrawDebug.hpp"
 #include "Lorebox.h"
 #include "Manager.h"
+#include "Queue.h"
 #include "Utils.h"
 
 template <typename MenuType>
@@ -44,6 +45,7 @@ RE::UI_MESSAGE_RESULTS Hooks::MenuHook<MenuType>::ProcessMessage_Hook(RE::UIMess
 template <typename MenuType>
 void Hooks::MenuHook<MenuType>::AdvanceMovie_Hook(float a_interval, std::uint32_t a_currentTime) {
     _AdvanceMovie(this, a_interval, a_currentTime);
+    QueueManager::GetSingleton()->DrainUpdates();
     M->ProcessDirtyRefs_();
 }
 
@@ -70,6 +72,7 @@ void Hooks::Install() {
 
 void Hooks::UpdateHook::Update(RE::Actor* a_this, float a_delta) {
     Update_(a_this, a_delta);
+    QueueManager::GetSingleton()->DrainUpdates();
     M->ProcessDirtyRefs_();
 
     #ifndef NDEBUG
@@ -90,7 +93,7 @@ void Hooks::add_item_functor(RE::TESObjectREFR* a_this, RE::TESObjectREFR* a_obj
 
     add_item_functor_(a_this, a_object, a_count, a4, a5);
 
-    M->Update(nullptr, a_this, a_object, a_count);
+    QueueManager::GetSingleton()->QueueUpdate(nullptr, a_this, a_object, a_count);
 }
 
 template <typename RefType>
@@ -105,7 +108,7 @@ void Hooks::MoveItemHooks<RefType>::pickUpObject(RefType* a_this, RE::TESObjectR
 
     pick_up_object_(a_this, a_object, a_count, a_arg3, a_play_sound);
 
-    M->Update(nullptr, a_this, a_object->GetBaseObject(), a_count, from_refid);
+    QueueManager::GetSingleton()->QueueUpdate(nullptr, a_this, a_object->GetBaseObject(), a_count, from_refid);
 }
 
 template <typename RefType>
@@ -127,13 +130,13 @@ RE::ObjectRefHandle* Hooks::MoveItemHooks<RefType>::RemoveItem(RefType* a_this,
                                             a_move_to_ref,
                                             a_drop_loc, a_rotate);
 
-    M->Update(a_this,
-              a_move_to_ref
-                  ? a_move_to_ref
-                  : res
-                  ? res->get().get()
-                  : nullptr,
-              a_item, a_count);
+    QueueManager::GetSingleton()->QueueUpdate(a_this,
+                                              a_move_to_ref
+                                                  ? a_move_to_ref
+                                                  : res
+                                                  ? res->get().get()
+                                                  : nullptr,
+                                              a_item, a_count);
 
     return res;
 }
@@ -149,5 +152,5 @@ void Hooks::MoveItemHooks<RefType>::addObjectToContainer(RefType* a_this, RE::TE
 
     add_object_to_container_(a_this, a_object, a_extraList, a_count, a_fromRefr);
 
-    M->Update(a_fromRefr, a_this, a_object, a_count);
+    QueueManager::GetSingleton()->QueueUpdate(a_fromRefr, a_this, a_object, a_count);
 }
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "LockProfiler.h"
+
+namespace {
+    std::atomic<LockProfiler::Site*> g_sites{nullptr};
+
+    void StoreMax(std::atomic<uint64_t>& a_max, const uint64_t value) {
+        uint64_t prev = a_max.load(std::memory_order_relaxed);
+        while (value > prev && !a_max.compare_exchange_weak(prev, value, std::memory_order_relaxed)) {
+        }
+    }
+}
+
+void LockProfiler::Histogram::Add(const uint64_t ns) {
+    const auto b = std::min<size_t>(static_cast<size_t>(std::bit_width(ns)), n_buckets - 1);
+    buckets[b].fetch_add(1, std::memory_order_relaxed);
+}
+
+void LockProfiler::Histogram::Reset() {
+    for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LockProfiler::Histogram::Quantile(const double q) const {
+    std::array<uint64_t, n_buckets> counts{};
+    uint64_t total = 0;
+    for (size_t b = 0; b < n_buckets; ++b) {
+        counts[b] = buckets[b].load(std::memory_order_relaxed);
+        total += counts[b];
+    }
+    if (!total) return 0;
+    const auto target = static_cast<uint64_t>(std::ceil(q * static_cast<double>(total)));
+    uint64_t seen = 0;
+    for (size_t b = 0; b < n_buckets; ++b) {
+        seen += counts[b];
+        if (seen >= target) return b ? (uint64_t{1} << b) - 1 : 0;
+    }
+    return (uint64_t{1} << (n_buckets - 1)) - 1;
+}
+
+LockProfiler::Site::Site(const char* a_mutex, const bool a_unique, const char* a_file, const int a_line,
+                         const char* a_func)
+    : mutex(a_mutex), func(a_func), file(a_file), line(a_line), unique(a_unique) {
+    next = g_sites.load(std::memory_order_relaxed);
+    while (!g_sites.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+}
+
+void LockProfiler::Site::RecordWait(const uint64_t ns) {
+    calls.fetch_add(1, std::memory_order_relaxed);
+    total_wait_ns.fetch_add(ns, std::memory_order_relaxed);
+    StoreMax(max_wait_ns, ns);
+    wait.Add(ns);
+}
+
+void LockProfiler::Site::RecordHold(const uint64_t ns) {
+    total_hold_ns.fetch_add(ns, std::memory_order_relaxed);
+    StoreMax(max_hold_ns, ns);
+    hold.Add(ns);
+}
+
+void LockProfiler::Site::Reset() {
+    calls.store(0, std::memory_order_relaxed);
+    total_wait_ns.store(0, std::memory_order_relaxed);
+    total_hold_ns.store(0, std::memory_order_relaxed);
+    max_wait_ns.store(0, std::memory_order_relaxed);
+    max_hold_ns.store(0, std::memory_order_relaxed);
+    wait.Reset();
+    hold.Reset();
+}
+
+std::vector<LockProfiler::Stats> LockProfiler::Snapshot(const size_t max_sites) {
+    std::vector<Stats> out;
+    for (auto* site = g_sites.load(std::memory_order_acquire); site; site = site->next) {
+        const auto calls = site->calls.load(std::memory_order_relaxed);
+        if (!calls) continue;
+        out.push_back({site->mutex, site->func, site->line, site->unique, calls,
+                       site->total_wait_ns.load(std::memory_order_relaxed), site->wait.Quantile(0.99),
+                       site->max_wait_ns.load(std::memory_order_relaxed),
+                       static_cast<double>(site->total_hold_ns.load(std::memory_order_relaxed)) /
+                       static_cast<double>(calls),
+                       site->hold.Quantile(0.99), site->max_hold_ns.load(std::memory_order_relaxed)});
+    }
+    std::ranges::sort(out, [](const Stats& a, const Stats& b) { return a.total_wait_ns > b.total_wait_ns; });
+    if (out.size() > max_sites) out.resize(max_sites);
+    return out;
+}
+
+void LockProfiler::ResetAll() {
+    for (auto* site = g_sites.load(std::memory_order_acquire); site; site = site->next) {
+        site->Reset();
+    }
+}
@@ -45,10 +45,9 @@ namespace {
         return std::format(L"{}h {}m", h, m);
     }
 
-    std::wstring StageNameOrW(const Source& src, const StageNo no, std::wstring fallback) {
-        const auto n = src.GetStageName(no);
-        if (!n.empty()) return Widen(n);
-        return fallback;
+    std::wstring StageNameOrW(const StageName& name, const StageNo no) {
+        if (!name.empty()) return Widen(name);
+        return std::format(L"Stage {}", no);
     }
 
     struct Transition {
@@ -59,56 +58,37 @@ namespace {
         std::wstring label; // pre-formatted label with arrow and target name
     };
 
-    Transition ComputeNext(const Source& src, const StageInstance& st) {
+    Transition ComputeNext(const StageRow& st) {
         Transition t{};
-        if (st.xtra.is_transforming) {
-            t.transforming = true;
-            const auto tr = st.GetDelayerFormID();
-            if (tr && src.settings.transformers.contains(tr)) {
-                t.nextFormId = src.settings.transformers.at(tr).first;
-                t.hasNext = t.nextFormId != 0;
-                t.label = std::format(L"{} {}", Lorebox::arrow_right, FormNameW(t.nextFormId));
-            } else {
-                t.label = std::format(L"{} (transform)", Lorebox::arrow_right);
-            }
-            return t;
-        }
-
-        const float slope = st.GetDelaySlope();
-        if (std::abs(slope) < EPSILON) {
-            // Frozen; keep empty label as current implementation
-            return t;
-        }
-
-        if (slope > 0.f) {
-            // Forward
-            if (src.IsStageNo(st.no + 1)) {
-                const auto ns = src.TryGetStage(st.no + 1);
-                t.nextFormId = ns->formid;
-                t.hasNext = true;
-                t.label = std::format(L"{} {}",
-                                      Lorebox::arrow_right,
-                                      StageNameOrW(src, st.no + 1, std::format(L"Stage {}", st.no + 1)));
-            } else {
-                t.nextFormId = src.settings.decayed_id;
-                t.hasNext = t.nextFormId != 0;
-                const auto decayed_form = RE::TESForm::LookupByID(t.nextFormId);
-                t.label = std::format(L"{} {}", Lorebox::arrow_right,
-                                      decayed_form ? Widen(decayed_form->GetName()) : L"");
-            }
-        } else {
-            // Backwards
-            t.backwards = true;
-            if (st.no > 0 && src.IsStageNo(st.no - 1)) {
-                const auto ps = src.TryGetStage(st.no - 1);
-                t.nextFormId = ps->formid;
-                t.hasNext = true;
-                t.label = std::format(L"{} {}",
-                                      Lorebox::arrow_left,
-                                      StageNameOrW(src, st.no - 1, std::format(L"Stage {}", st.no - 1)));
-            } else {
-                t.label = std::format(L"{} Initial", Lorebox::arrow_left);
-            }
+        t.nextFormId = st.next_formid;
+        t.hasNext = t.nextFormId != 0;
+        switch (st.direction) {
+            case StageRow::Direction::kTransform:
+                t.transforming = true;
+                t.label = t.hasNext
+                              ? std::format(L"{} {}", Lorebox::arrow_right, FormNameW(t.nextFormId))
+                              : std::format(L"{} (transform)", Lorebox::arrow_right);
+                break;
+            case StageRow::Direction::kForward:
+                if (st.next_is_stage) {
+                    t.hasNext = true;
+                    t.label = std::format(L"{} {}", Lorebox::arrow_right, StageNameOrW(st.next_name, st.next_no));
+                } else {
+                    t.label = std::format(L"{} {}", Lorebox::arrow_right, FormNameW(t.nextFormId));
+                }
+                break;
+            case StageRow::Direction::kBackward:
+                t.backwards = true;
+                if (st.next_is_stage) {
+                    t.hasNext = true;
+                    t.label = std::format(L"{} {}", Lorebox::arrow_left, StageNameOrW(st.next_name, st.next_no));
+                } else {
+                    t.label = std::format(L"{} Initial", Lorebox::arrow_left);
+                }
+                break;
+            case StageRow::Direction::kFrozen:
+                // Frozen; keep empty label as current implementation
+                break;
         }
         return t;
     }
@@ -117,6 +97,7 @@ namespace {
         Count count{};
         int minutes{-1};
         float slope{1.f};
+        float multiplier{1.f};
         FormID mod{0};
         bool transforming{false};
         bool frozen{false};
@@ -127,42 +108,25 @@ namespace {
         std::wstring curr; // current stage name if available
     };
 
-    int ComputeMinutesRemaining(const Source& src, const StageInstance& st, const float now) {
-        const float slope = st.GetDelaySlope();
-        if (std::abs(slope) < EPSILON) {
+    int ComputeMinutesRemaining(const StageRow& st, const float now) {
+        if (std::abs(st.slope) < EPSILON) {
             return -1;
         }
 
-        const float nextT = src.GetNextUpdateTime(&st);
-        if (nextT <= 0.f) {
+        if (st.next_update_time <= 0.f) {
             return -1;
         }
 
-        return static_cast<int>(std::round((nextT - now) * 60.f));
+        return static_cast<int>(std::round((st.next_update_time - now) * 60.f));
     }
 
-    int ComputePercentage(const Source& src, const StageInstance& st, const float now) {
-        float pct = -1.f;
-        if (st.xtra.is_transforming) {
-            const auto tr = st.GetDelayerFormID();
-            if (tr && src.settings.transformers.contains(tr)) {
-                const float elapsed = st.GetTransformElapsed(now);
-                const float total = std::get<1>(src.settings.transformers.at(tr));
-                if (total > 0.f) pct = std::clamp(elapsed / total * 100.f, 0.f, 100.f);
-            }
-        } else {
-            if (src.IsStageNo(st.no)) {
-                const float elapsed = st.GetElapsed(now);
-                const float total = src.GetStageDuration(st.no);
-                if (total > 0.f) pct = std::clamp(elapsed / total * 100.f, 0.f, 100.f);
-            }
-        }
-
-        if (pct < 0.f) return -1;
-        return static_cast<int>(std::round(pct));
+    int ComputePercentage(const StageRow& st, const float now) {
+        const float progress = st.ProgressAt(now);
+        if (progress < 0.f) return -1;
+        return static_cast<int>(std::round(progress * 100.f));
     }
 
-    std::wstring BuildModulatorTag(const Source& src, const Row& r) {
+    std::wstring BuildModulatorTag(const Row& r) {
         if (!Lorebox::show_modulator_name.load(std::memory_order_relaxed)) return {};
 
         auto nm = FormNameW(r.mod);
@@ -173,11 +137,7 @@ namespace {
         }
 
         if (Lorebox::show_multiplier.load(std::memory_order_relaxed)) {
-            float mult = r.slope;
-            if (src.settings.delayers.contains(r.mod)) {
-                mult = src.settings.delayers.at(r.mod);
-            }
-            nm += std::format(L": x{:.2f}", mult);
+            nm += std::format(L": x{:.2f}", r.multiplier);
         }
         return std::format(L"[{}]", nm);
     }
@@ -269,58 +229,53 @@ bool Lorebox::IsRemoved(const FormID a_formid) {
 }
 
 std::wstring Lorebox::BuildLoreFor(FormID hovered, RefID ownerId) {
-    // Snapshot sources safely
-    const auto sources = M->GetSourcesByStageAndOwner(hovered, ownerId);
-    if (sources.empty()) return return_str;
+    if (ownerId == 0) return return_str;
 
     const auto now = RE::Calendar::GetSingleton()->GetHoursPassed();
 
-    // Collect rows for hovered base item (one row per StageInstance)
+    // Rows of the hovered base item at the owner (one per StageInstance) from the published read model;
+    // the buffer is reused across hovers
+    thread_local std::vector<StageRow> stage_rows;
+    M->QueryStageRows(hovered, ownerId, stage_rows);
+    if (stage_rows.empty()) return return_str;
+
     std::vector<Row> rows;
-    rows.reserve(16);
-
-    if (ownerId > 0) {
-        for (const auto& src : sources) {
-            if (!src.data.contains(ownerId)) continue;
-
-            for (const auto& st : src.data.at(ownerId)) {
-                if (st.count <= 0 || st.xtra.is_decayed) continue;
-                if (st.xtra.form_id != hovered) continue;
-
-                const auto trans = ComputeNext(src, st);
-                const bool isFrozen = (trans.nextFormId != 0 && trans.nextFormId == st.xtra.form_id);
-
-                Row r;
-                r.count = st.count;
-                r.slope = st.GetDelaySlope();
-                r.mod = st.GetDelayerFormID();
-                r.transforming = st.xtra.is_transforming;
-                r.frozen = isFrozen;
-                if (!isFrozen) {
-                    r.next = trans.label;
-                }
-                if (const auto curName = src.GetStageName(st.no); !curName.empty()) {
-                    r.curr = Widen(curName);
-                }
+    rows.reserve(stage_rows.size());
+
+    for (const auto& st : stage_rows) {
+        const auto trans = ComputeNext(st);
+        const bool isFrozen = (trans.nextFormId != 0 && trans.nextFormId == st.form_id);
+
+        Row r;
+        r.count = st.count;
+        r.slope = st.slope;
+        r.multiplier = st.delayer_multiplier;
+        r.mod = st.delayer;
+        r.transforming = st.is_transforming;
+        r.frozen = isFrozen;
+        if (!isFrozen) {
+            r.next = trans.label;
+        }
+        if (!st.name.empty()) {
+            r.curr = Widen(st.name);
+        }
 
-                r.minutes = ComputeMinutesRemaining(src, st, now);
-                if (isFrozen) {
-                    r.minutes = -1;
-                }
+        r.minutes = ComputeMinutesRemaining(st, now);
+        if (isFrozen) {
+            r.minutes = -1;
+        }
 
-                if (show_percentage.load(std::memory_order_relaxed)) {
-                    r.pct = ComputePercentage(src, st, now);
-                }
+        if (show_percentage.load(std::memory_order_relaxed)) {
+            r.pct = ComputePercentage(st, now);
+        }
 
-                if (r.minutes < 0 && std::abs(r.slope) >= EPSILON && !r.frozen) {
-                    r.pct = 100;
-                }
+        if (r.minutes < 0 && std::abs(r.slope) >= EPSILON && !r.frozen) {
+            r.pct = 100;
+        }
 
-                r.tag = BuildModulatorTag(src, r);
+        r.tag = BuildModulatorTag(r);
 
-                rows.push_back(std::move(r));
-            }
-        }
+        rows.push_back(std::move(r));
     }
 
     if (rows.empty()) return return_str;
@@ -2,6 +2,8 @@
 #include "SimpleIni.h"
 #include "Lorebox.h"
 #include "Manager.h"
+#include "LockProfiler.h"
+#include "Profiler.h"
 #include "ClibUtil/editorID.hpp"
 
 #ifndef IM_ARRAYSIZE
@@ -74,6 +76,20 @@ void __stdcall UI::RenderSettings() {
     ImGuiMCP::SameLine();
     HelpMarker("Limits how many objects are updated each tick.");
 
+    ImGuiMCP::SetNextItemWidth(320.f);
+    int dirty_update_budget = static_cast<int>(Settings::dirty_update_budget_us.load());
+    if (ImGuiMCP::SliderInt("Update Budget (us)", &dirty_update_budget,
+                            static_cast<int>(Settings::dirty_update_budget_us_min),
+                            static_cast<int>(Settings::dirty_update_budget_us_max))) {
+        Settings::dirty_update_budget_us.store(std::clamp(static_cast<uint32_t>(dirty_update_budget),
+                                                          Settings::dirty_update_budget_us_min,
+                                                          Settings::dirty_update_budget_us_max));
+        PresetParse::SaveSettings();
+    }
+    ImGuiMCP::SameLine();
+    HelpMarker("Time per frame the object updates may take. What does not fit waits for the next frame, "
+               "nearby and long-waiting objects first.");
+
     ImGuiMCP::Text("Update Frequency");
     ImGuiMCP::SetNextItemWidth(180.f);
     const auto ticker_speed_str = Settings::Ticker::to_string(Settings::ticker_speed);
@@ -137,6 +153,14 @@ void __stdcall UI::RenderStatus() {
         ImGuiMCP::EndTable();
     }
 
+    InstanceMemory();
+    DirtyRefUpdates();
+    if constexpr (Profiler::Enabled()) {
+        HotPathTimings();
+    }
+    if constexpr (LockProfiler::Enabled()) {
+        LockContention();
+    }
     ExcludeList();
 }
 
@@ -676,6 +700,144 @@ void UI::Register() {
     SKSEMenuFramework::AddSectionItem("Log", RenderLog);
 }
 
+void UI::InstanceMemory() {
+    static Manager::MemoryReport report;
+    static bool measured = false;
+
+    ImGuiMCP::Text("");
+    ImGuiMCP::Text("Instance Memory:");
+    ImGuiMCP::SameLine();
+    if (ImGuiMCP::Button("Measure##instance_memory")) {
+        report = M->GetMemoryReport();
+        measured = true;
+    }
+    if (!measured) return;
+
+    if (ImGuiMCP::BeginTable("table_memory", 2, table_flags)) {
+        const auto row = [](const char* label, const std::string& value) {
+            ImGuiMCP::TableNextRow();
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(label);
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(value.c_str());
+        };
+        row("Instances", std::format("{} in {} locations", report.n_instances, report.n_locations));
+        row("Bytes per instance", std::format("{} (was {} with inline editor IDs)", report.bytes_per_instance,
+                                              report.legacy_bytes_per_instance));
+        row("Instance data", std::format("{:.1f} KB (was {:.1f} KB)",
+                                         static_cast<double>(report.n_instances * report.bytes_per_instance) / 1024.0,
+                                         static_cast<double>(report.n_instances * report.legacy_bytes_per_instance) /
+                                         1024.0));
+        row("Interned editor IDs", std::format("{} ({:.1f} KB)", report.n_editor_ids,
+                                               static_cast<double>(report.editor_id_pool_bytes) / 1024.0));
+        ImGuiMCP::EndTable();
+    }
+}
+
+void UI::DirtyRefUpdates() {
+    ImGuiMCP::Text("");
+    ImGuiMCP::Text("Object Updates Per Frame:");
+    ImGuiMCP::SameLine();
+    if (ImGuiMCP::Button("Reset##dirty_ref_updates")) {
+        M->ResetDirtyRefStats();
+    }
+
+    const auto stats = M->GetDirtyRefStats();
+    if (ImGuiMCP::BeginTable("table_dirty_refs", 2, table_flags)) {
+        const auto row = [](const char* label, const std::string& value) {
+            ImGuiMCP::TableNextRow();
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(label);
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(value.c_str());
+        };
+        row("Frames", std::format("{} ({} over budget)", stats.frames, stats.over_budget));
+        row("Objects updated", std::format("{}", stats.refs));
+        row("Frame time (us)", std::format("avg {:.0f}, p99 {}, max {}", stats.avg_us, stats.p99_us,
+                                           stats.max_us));
+        row("Waiting", std::format("{}", stats.backlog));
+        ImGuiMCP::EndTable();
+    }
+}
+
+void UI::HotPathTimings() {
+    ImGuiMCP::Text("");
+    ImGuiMCP::Text("Hot Path Timings:");
+    ImGuiMCP::SameLine();
+    if (ImGuiMCP::Button("Reset##hot_path_timings")) {
+        Profiler::ResetAll();
+    }
+
+    const bool show_allocs = Profiler::CountsAllocations();
+    if (ImGuiMCP::BeginTable("table_hot_paths", show_allocs ? 5 : 4, table_flags)) {
+        ImGuiMCP::TableSetupColumn("Function");
+        ImGuiMCP::TableSetupColumn("Calls");
+        ImGuiMCP::TableSetupColumn("ns/op");
+        ImGuiMCP::TableSetupColumn("Max ns");
+        if (show_allocs) ImGuiMCP::TableSetupColumn("Allocs/op");
+        ImGuiMCP::TableHeadersRow();
+        for (const auto& stats : Profiler::Snapshot()) {
+            ImGuiMCP::TableNextRow();
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(stats.name);
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{}", stats.calls).c_str());
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{:.0f}", stats.ns_per_op).c_str());
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{}", stats.max_ns).c_str());
+            if (!show_allocs) continue;
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{:.2f}", stats.allocs_per_op).c_str());
+        }
+        ImGuiMCP::EndTable();
+    }
+}
+
+void UI::LockContention() {
+    ImGuiMCP::Text("");
+    ImGuiMCP::Text("Lock Contention:");
+    ImGuiMCP::SameLine();
+    if (ImGuiMCP::Button("Reset##lock_contention")) {
+        LockProfiler::ResetAll();
+    }
+
+    if (ImGuiMCP::BeginTable("table_lock_contention", 9, table_flags)) {
+        ImGuiMCP::TableSetupColumn("Mutex");
+        ImGuiMCP::TableSetupColumn("Site");
+        ImGuiMCP::TableSetupColumn("Calls");
+        ImGuiMCP::TableSetupColumn("Wait ms");
+        ImGuiMCP::TableSetupColumn("p99 wait ns");
+        ImGuiMCP::TableSetupColumn("Max wait ns");
+        ImGuiMCP::TableSetupColumn("Avg hold ns");
+        ImGuiMCP::TableSetupColumn("p99 hold ns");
+        ImGuiMCP::TableSetupColumn("Max hold ns");
+        ImGuiMCP::TableHeadersRow();
+        for (const auto& stats : LockProfiler::Snapshot(20)) {
+            ImGuiMCP::TableNextRow();
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{} ({})", stats.mutex, stats.unique ? "unique" : "shared").c_str());
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{}:{}", stats.func, stats.line).c_str());
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{}", stats.calls).c_str());
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{:.3f}", static_cast<double>(stats.total_wait_ns) / 1e6).c_str());
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{}", stats.p99_wait_ns).c_str());
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{}", stats.max_wait_ns).c_str());
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{:.0f}", stats.avg_hold_ns).c_str());
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{}", stats.p99_hold_ns).c_str());
+            ImGuiMCP::TableNextColumn();
+            ImGuiMCP::Text(std::format("{}", stats.max_hold_ns).c_str());
+        }
+        ImGuiMCP::EndTable();
+    }
+}
+
 void UI::ExcludeList() {
     ImGuiMCP::Text("");
     ImGuiMCP::Text("Exclusions per Module:");
@@ -761,87 +923,61 @@ void UI::UpdateSubItem() {
     }
 }
 
-void UI::UpdateLocationMap(const std::vector<Source>& sources) {
-    locations.clear();
-
-    for (const auto& source : sources) {
-        for (const auto& [location, instances] : source.data) {
-            const auto* locationReference = RE::TESForm::LookupByID<RE::TESObjectREFR>(location);
-            std::string locationName_temp;
-            if (locationReference) {
-                locationName_temp = locationReference->GetName();
-                if (locationReference->HasContainer()) locationName_temp += std::format(" ({:x})", location);
-            } else {
-                locationName_temp = std::format("{:x}", location);
-            }
-            const char* locationName = locationName_temp.c_str();
-            for (auto& stageInstance : instances) {
-                const auto* delayerForm = RE::TESForm::LookupByID(stageInstance.GetDelayerFormID());
-                auto delayer_name = delayerForm
-                                        ? delayerForm->GetName()
-                                        : std::format("{:x}", stageInstance.GetDelayerFormID());
-                if (delayer_name == "0") delayer_name = "None";
-                int max_stage_no = 0;
-                while (source.IsStageNo(max_stage_no + 1)) max_stage_no++;
-
-                const auto temp_stage_no = std::make_pair(stageInstance.no, max_stage_no);
-                auto temp_stagename = source.GetStageName(stageInstance.no);
-                temp_stagename = temp_stagename.empty() ? "" : std::format("({})", temp_stagename);
-                Instance instance(
-                    temp_stage_no,
-                    temp_stagename,
-                    stageInstance.count,
-                    stageInstance.start_time,
-                    source.GetStageDuration(stageInstance.no),
-                    stageInstance.GetDelayMagnitude(),
-                    delayer_name,
-                    stageInstance.xtra.is_fake,
-                    stageInstance.xtra.is_transforming,
-                    stageInstance.xtra.is_decayed
-                    );
-
-                const auto item = RE::TESForm::LookupByID(source.formid);
-                locations[std::string(locationName) + "##location"][
-                        (item ? item->GetName() : source.editorid) + "##item"]
-                    .push_back(
-                        instance);
-            }
+void UI::UpdateLocationMap(const std::vector<StageRow>& rows) {
+    for (const auto& row : rows) {
+        const auto* locationReference = RE::TESForm::LookupByID<RE::TESObjectREFR>(row.location);
+        std::string locationName;
+        if (locationReference) {
+            locationName = locationReference->GetName();
+            if (locationReference->HasContainer()) locationName += std::format(" ({:x})", row.location);
+        } else {
+            locationName = std::format("{:x}", row.location);
         }
-    }
-
-    if (const auto current = locations.find(item_current); current == locations.end()) {
-        item_current = "##current";
-        sub_item_current = "##item";
-    } else if (const auto item = current->second; !item.contains(sub_item_current)) {
-        sub_item_current = "##item";
+        const auto* delayerForm = RE::TESForm::LookupByID(row.delayer);
+        auto delayer_name = delayerForm ? delayerForm->GetName() : std::format("{:x}", row.delayer);
+        if (delayer_name == "0") delayer_name = "None";
+
+        Instance instance(
+            std::make_pair(row.no, row.max_no),
+            row.name.empty() ? "" : std::format("({})", row.name),
+            row.count,
+            row.start_time,
+            row.duration,
+            row.delay_magnitude,
+            delayer_name,
+            row.is_fake,
+            row.is_transforming,
+            row.is_decayed
+            );
+
+        const auto item = RE::TESForm::LookupByID(row.source_formid);
+        std::string item_name = item ? item->GetName() : "";
+        if (item_name.empty()) item_name = clib_util::editorID::get_editorID(item);
+        if (item_name.empty()) item_name = std::format("{:x}", row.source_formid);
+        locations[locationName + "##location"][item_name + "##item"].push_back(std::move(instance));
     }
 }
 
-void UI::UpdateStages(const std::vector<Source>& sources) {
+void UI::UpdateStages(const std::vector<SourceSummary>& summaries) {
     mcp_sources.clear();
 
-    for (const auto& source : sources) {
-        if (!source.IsHealthy()) continue;
-        StageNo max_stage_no = 0;
+    for (const auto& source : summaries) {
         std::set<Stage> temp_stages;
-        while (source.IsStageNo(max_stage_no)) {
-            if (const auto* stage = source.TryGetStage(max_stage_no)) {
-                const auto* temp_form = RE::TESForm::LookupByID(stage->formid);
-                if (!temp_form) continue;
-                const GameObject item = {temp_form->GetName(), stage->formid};
-                temp_stages.insert(Stage(item, stage->name, stage->duration, source.IsFakeStage(max_stage_no),
-                                         stage->crafting_allowed, max_stage_no));
-            }
-            max_stage_no++;
+        for (const auto& stage : source.stages) {
+            const auto* temp_form = RE::TESForm::LookupByID(stage.formid);
+            if (!temp_form) continue;
+            const GameObject item = {temp_form->GetName(), stage.formid};
+            temp_stages.insert(Stage(item, stage.name, stage.duration, stage.is_fake, stage.crafting_allowed,
+                                     stage.no));
         }
-        const auto& stage = source.GetDecayedStage();
+        const auto& stage = source.decayed;
         if (const auto* temp_form = RE::TESForm::LookupByID(stage.formid)) {
             const GameObject item = {.name = temp_form->GetName(), .formid = stage.formid};
-            temp_stages.insert(Stage(item, "Final", 0.f, source.IsFakeStage(max_stage_no), stage.crafting_allowed,
-                                     max_stage_no));
+            temp_stages.insert(Stage(item, stage.name, stage.duration, stage.is_fake, stage.crafting_allowed,
+                                     stage.no));
         }
         std::set<GameObject> containers_;
-        for (const auto& container : source.settings.containers) {
+        for (const auto& container : source.containers) {
             const auto temp_formid = container;
             const auto temp_name = GetName(temp_formid);
             containers_.insert(GameObject{temp_name, temp_formid});
@@ -850,7 +986,7 @@ void UI::UpdateStages(const std::vector<Source>& sources) {
         std::set<GameObject> transformers_;
         std::map<FormID, GameObject> transformer_enditems_;
         std::map<FormID, Duration> transform_durations_;
-        for (const auto& [fst, snd] : source.settings.transformers) {
+        for (const auto& [fst, snd] : source.transformers) {
             auto temp_formid = fst;
             const auto temp_name = GetName(temp_formid);
             transformers_.insert(GameObject{temp_name, temp_formid});
@@ -861,7 +997,7 @@ void UI::UpdateStages(const std::vector<Source>& sources) {
         }
         std::set<GameObject> time_modulators_;
         std::map<FormID, float> time_modulator_multipliers_;
-        for (const auto& [fst, snd] : source.settings.delayers) {
+        for (const auto& [fst, snd] : source.delayers) {
             auto temp_formid = fst;
             const auto temp_form = RE::TESForm::LookupByID(temp_formid);
             const auto temp_name = temp_form ? temp_form->GetName() : std::format("{:x}", temp_formid);
@@ -898,9 +1034,25 @@ void UI::Refresh() {
         }
     }
 
-    const auto sources = M->GetSources();
-    UpdateLocationMap(sources);
-    UpdateStages(sources);
+    // page through the instances so only one page is copied at a time; all pages come from the same
+    // model, so a publish in between cannot shift or repeat rows
+    locations.clear();
+    const auto model = M->GetReadModel();
+    std::vector<StageRow> rows;
+    for (size_t offset = 0;;) {
+        const auto total = Manager::QueryInstancePage(*model, offset, refresh_page_size, rows);
+        UpdateLocationMap(rows);
+        offset += rows.size();
+        if (rows.empty() || offset >= total) break;
+    }
+    if (const auto current = locations.find(item_current); current == locations.end()) {
+        item_current = "##current";
+        sub_item_current = "##item";
+    } else if (const auto& item = current->second; !item.contains(sub_item_current)) {
+        sub_item_current = "##item";
+    }
+
+    UpdateStages(*M->GetSourceSummaries());
 
     update_q.clear();
     for (const auto [refid, stop_time] : M->GetUpdateQueue()) {
@@ -6,6 +6,8 @@
 #include <unordered_map>
 #include "CellScan.h"
 #include "Hooks.h"
+#include "LockProfiler.h"
+#include "Profiler.h"
 #include "Queue.h"
 #include "Settings.h"
 
@@ -223,6 +225,26 @@ namespace {
 #define SRC_UNIQUE_GUARD  DebugUniqueLock<SourceMutexTag> AOT_CONCAT(src_ulock_, __COUNTER__)(&sourceMutex_, __FILE__, __LINE__, __func__)
 #define QUE_SHARED_GUARD  DebugSharedLock<QueueMutexTag>  AOT_CONCAT(que_slock_, __COUNTER__)(&queueMutex_,  __FILE__, __LINE__, __func__)
 #define QUE_UNIQUE_GUARD  DebugUniqueLock<QueueMutexTag>  AOT_CONCAT(que_ulock_, __COUNTER__)(&queueMutex_,  __FILE__, __LINE__, __func__)
+#define DATA_SHARED_GUARD(src) std::shared_lock AOT_CONCAT(data_slock_, __COUNTER__){(src).mutex}
+#define DATA_UNIQUE_GUARD(src) std::unique_lock AOT_CONCAT(data_ulock_, __COUNTER__){(src).mutex}
+
+#elif defined(AOT_LOCK_PROFILING)
+// Release macros with contention profiling: one static site per expansion, keyed by __COUNTER__
+#define AOT_CONCAT_INNER(a,b) a##b
+#define AOT_CONCAT(a,b) AOT_CONCAT_INNER(a,b)
+namespace {
+    template <int Id>
+    LockProfiler::Site& LockSite(const char* mutex, const bool unique, const char* file, const int line, const char* func) {
+        static LockProfiler::Site site{mutex, unique, file, line, func};
+        return site;
+    }
+}
+#define SRC_SHARED_GUARD  LockProfiler::ProfiledLock<false> AOT_CONCAT(src_slock_, __COUNTER__){sourceMutex_, LockSite<__COUNTER__>("sourceMutex_", false, __FILE__, __LINE__, __func__)}
+#define SRC_UNIQUE_GUARD  LockProfiler::ProfiledLock<true>  AOT_CONCAT(src_ulock_, __COUNTER__){sourceMutex_, LockSite<__COUNTER__>("sourceMutex_", true, __FILE__, __LINE__, __func__)}
+#define QUE_SHARED_GUARD  LockProfiler::ProfiledLock<false> AOT_CONCAT(que_slock_, __COUNTER__){queueMutex_, LockSite<__COUNTER__>("queueMutex_", false, __FILE__, __LINE__, __func__)}
+#define QUE_UNIQUE_GUARD  LockProfiler::ProfiledLock<true>  AOT_CONCAT(que_ulock_, __COUNTER__){queueMutex_, LockSite<__COUNTER__>("queueMutex_", true, __FILE__, __LINE__, __func__)}
+#define DATA_SHARED_GUARD(src) LockProfiler::ProfiledLock<false> AOT_CONCAT(data_slock_, __COUNTER__){(src).mutex, LockSite<__COUNTER__>("Source::mutex", false, __FILE__, __LINE__, __func__)}
+#define DATA_UNIQUE_GUARD(src) LockProfiler::ProfiledLock<true>  AOT_CONCAT(data_ulock_, __COUNTER__){(src).mutex, LockSite<__COUNTER__>("Source::mutex", true, __FILE__, __LINE__, __func__)}
 
 #else
 // Release macros map to std locks with CTAD
@@ -232,12 +254,15 @@ namespace {
 #define SRC_UNIQUE_GUARD  std::unique_lock  AOT_CONCAT(src_ulock_, __COUNTER__){sourceMutex_}
 #define QUE_SHARED_GUARD  std::shared_lock  AOT_CONCAT(que_slock_, __COUNTER__){queueMutex_}
 #define QUE_UNIQUE_GUARD  std::unique_lock  AOT_CONCAT(que_ulock_, __COUNTER__){queueMutex_}
+#define DATA_SHARED_GUARD(src) std::shared_lock AOT_CONCAT(data_slock_, __COUNTER__){(src).mutex}
+#define DATA_UNIQUE_GUARD(src) std::unique_lock AOT_CONCAT(data_ulock_, __COUNTER__){(src).mutex}
 #endif
 
 void Manager::AddLocationIndex(const RefID location_id, const FormID source_formid) {
     if (!location_id || !source_formid) {
         return;
     }
+    std::lock_guard lock(registryMutex_);
     loc_to_sources[location_id].insert(source_formid);
 }
 
@@ -245,6 +270,7 @@ void Manager::RemoveLocationIndex(const RefID location_id, const FormID source_f
     if (!location_id || !source_formid) {
         return;
     }
+    std::lock_guard lock(registryMutex_);
     const auto it = loc_to_sources.find(location_id);
     if (it == loc_to_sources.end()) {
         return;
@@ -255,13 +281,36 @@ void Manager::RemoveLocationIndex(const RefID location_id, const FormID source_f
     }
 }
 
-void Manager::UpdateLocationIndexForSource(const Source& src, const RefID location_id) {
+std::vector<FormID> Manager::GetLocationSources_(const RefID location_id) {
+    std::lock_guard lock(registryMutex_);
+    const auto it = loc_to_sources.find(location_id);
+    if (it == loc_to_sources.end()) {
+        return {};
+    }
+    return {it->second.begin(), it->second.end()};
+}
+
+bool Manager::IsDoNotRegister_(const FormID some_formid) {
+    std::lock_guard lock(registryMutex_);
+    return do_not_register.contains(some_formid);
+}
+
+void Manager::AddDoNotRegister_(const FormID some_formid) {
+    std::lock_guard lock(registryMutex_);
+    do_not_register.insert(some_formid);
+}
+
+void Manager::UpdateLocationIndexForSource(Source& src, const RefID location_id) {
     if (!location_id) {
         return;
     }
 
+    MarkReadModelDirty_(location_id);
+
     const auto it = src.data.find(location_id);
     if (it == src.data.end() || it->second.empty()) {
+        // the Source keeps its stage index in step with data, except when data[location_id] is erased outright
+        src.ReindexLocation(location_id);
         RemoveLocationIndex(location_id, src.formid);
         return;
     }
@@ -274,7 +323,11 @@ void Manager::RefreshLocationIndex(const RefID location_id) {
         return;
     }
 
-    loc_to_sources.erase(location_id);
+    MarkReadModelDirty_(location_id);
+    {
+        std::lock_guard lock(registryMutex_);
+        loc_to_sources.erase(location_id);
+    }
     for (const auto& src : sources | std::views::values) {
         if (!src || !src->IsHealthy()) {
             continue;
@@ -283,13 +336,30 @@ void Manager::RefreshLocationIndex(const RefID location_id) {
     }
 }
 
+std::vector<FormID> Manager::CollectScanBases_(const Source& src, const StageNo no) {
+    std::vector<FormID> bases;
+    bases.reserve(src.settings.transformers_order.size() + src.settings.delayers_order.size());
+
+    // Include all bases we want CellScanner to collect for this WO.
+    for (const auto trns : src.settings.transformers_order) {
+        if (src.settings.transformer_allowed_stages.at(trns).contains(no)) {
+            bases.push_back(trns);
+        }
+    }
+    for (const auto dlyr : src.settings.delayers_order) {
+        if (src.settings.delayer_allowed_stages.at(dlyr).contains(no)) {
+            bases.push_back(dlyr);
+        }
+    }
+    return bases;
+}
+
 std::vector<Manager::ScanRequest> Manager::BuildCellScanRequests_(
-    const std::vector<RefInfo>& refStopsCopy) {
+    const std::vector<RefInfo>& refStopsCopy) const {
     std::vector<ScanRequest> out;
     out.reserve(refStopsCopy.size());
 
-    // Only touches plugin-owned data => guarded by sourceMutex_.
-    SRC_SHARED_GUARD;
+    const auto model = GetReadModel();
 
     for (const auto& ref_info : refStopsCopy) {
         const auto refid = ref_info.ref_id;
@@ -297,68 +367,33 @@ std::vector<Manager::ScanRequest> Manager::BuildCellScanRequests_(
             continue;
         }
 
-        const auto src = GetSourceByLocation(refid);
-        if (!src || !src->IsHealthy()) {
+        const auto view = model->Find(refid);
+        if (!view || view->scan_bases.empty()) {
             continue;
         }
 
-        const auto it = src->data.find(refid);
-        if (it == src->data.end() || it->second.empty()) {
-            continue;
-        }
-
-        const auto& inst = it->second.front();
-        if (inst.count <= 0) {
-            continue;
-        }
-
-        const StageNo no = inst.no;
-
-        std::vector<FormID> bases;
-        bases.reserve(src->settings.transformers_order.size() + src->settings.delayers_order.size());
-
-        // Include all bases we want CellScanner to collect for this WO.
-        for (const auto trns : src->settings.transformers_order) {
-            if (src->settings.transformer_allowed_stages.at(trns).contains(no)) {
-                bases.push_back(trns);
-            }
-        }
-        for (const auto dlyr : src->settings.delayers_order) {
-            if (src->settings.delayer_allowed_stages.at(dlyr).contains(no)) {
-                bases.push_back(dlyr);
-            }
-        }
-
-        if (!bases.empty()) {
-            out.emplace_back(ref_info, std::move(bases));
-        }
+        out.emplace_back(ref_info, view->scan_bases);
     }
 
     return out;
 }
 
-bool Manager::LocHasStage(Source* src, const RefID loc, const FormID stage_formid) {
+bool Manager::LocHasStage(const Source* src, const RefID loc, const FormID stage_formid) {
     if (!src) return false;
-    const auto it = src->data.find(loc);
-    if (it == src->data.end()) return false;
-
-    for (const auto& inst : it->second) {
-        if (inst.count > 0 && inst.xtra.form_id == stage_formid) {
-            return true;
-        }
-    }
-    return false;
+    const auto slots = src->FindStageSlots(loc, stage_formid);
+    return slots && !slots->slots.empty();
 }
 
 Source* Manager::UpdateGetSource(const FormID stage_formid, const RefID owner_refid) {
     if (!stage_formid) return nullptr;
-    if (do_not_register.contains(stage_formid)) return nullptr;
+    if (IsDoNotRegister_(stage_formid)) return nullptr;
 
     if (owner_refid) {
+        const auto owner_sources = GetLocationSources_(owner_refid);
+
         // 1) If this owner belongs to exactly 1 source, just take it (no scan)
-        const auto lit = loc_to_sources.find(owner_refid);
-        if (lit != loc_to_sources.end() && lit->second.size() == 1) {
-            const FormID src_formid = *lit->second.begin();
+        if (owner_sources.size() == 1) {
+            const FormID src_formid = owner_sources.front();
             if (const auto it = sources.find(src_formid); it != sources.end()) {
                 const auto s = it->second.get();
                 if (s && s->IsHealthy() && s->IsStage(stage_formid)) {
@@ -372,19 +407,20 @@ Source* Manager::UpdateGetSource(const FormID stage_formid, const RefID owner_re
 
         const auto sit = stage_to_sources.find(stage_formid);
 
-        if (lit != loc_to_sources.end() && sit != stage_to_sources.end()) {
+        if (!owner_sources.empty() && sit != stage_to_sources.end()) {
             // exact match: intersection candidates where this owner already has this stage
-            for (const FormID src_formid : lit->second) {
+            for (const FormID src_formid : owner_sources) {
                 if (!sit->second.contains(src_formid)) continue;
                 const auto srcIt = sources.find(src_formid);
                 if (srcIt == sources.end()) continue;
                 const auto src = srcIt->second.get();
                 if (!src || !src->IsHealthy()) continue;
+                DATA_SHARED_GUARD(*src);
                 if (LocHasStage(src, owner_refid, stage_formid)) return src;
             }
 
             // if none has it yet, pick any healthy source from the intersection
-            for (const FormID src_formid : lit->second) {
+            for (const FormID src_formid : owner_sources) {
                 if (!sit->second.contains(src_formid)) continue;
                 const auto srcIt = sources.find(src_formid);
                 if (srcIt == sources.end()) continue;
@@ -445,29 +481,48 @@ void Manager::UpdateImpl(RE::TESObjectREFR* from, RE::TESObjectREFR* to, const R
     }
 
     Source* src;
+    bool applied = false;
     const auto loc =
         ctx.from ? ctx.from->GetFormID() : (ctx.from_refid ? ctx.from_refid : (ctx.to ? ctx.to->GetFormID() : 0));
 
     {
         SRC_SHARED_GUARD;
         src = UpdateGetSource(ctx.what->GetFormID(), loc);
+        // a transfer that stays inside one source only needs that source's lock
+        if (src && IsConfinedTransfer_(*src, ctx)) {
+            DATA_UNIQUE_GUARD(*src);
+            ApplyTransferToSource_(*src, ctx, ctx.to && ctx.to->HasContainer() ? ctx.to->GetInventory() : InvMap{});
+            MarkReadModelDirty_(loc);
+            MarkReadModelDirty_(ctx.to_refid);
+            applied = true;
+        }
     }
     if (!src) {
         RefreshRefs_(ctx);
         return;
     }
 
-    {
+    if (!applied) {
         SRC_UNIQUE_GUARD;
         if (src = UpdateGetSource(ctx.what->GetFormID(), loc); src) {
             ApplyTransferToSource_(*src, ctx, ctx.to && ctx.to->HasContainer() ? ctx.to->GetInventory() : InvMap{});
             SplitWorldObjectStackIfNeeded_(*src, ctx);
+            MarkReadModelDirty_(loc);
+            MarkReadModelDirty_(ctx.to_refid);
         }
     }
 
     RefreshRefs_(ctx);
 }
 
+bool Manager::IsConfinedTransfer_(const Source& src, const UpdateCtx& ctx) {
+    // world object targets get split into new refs, and Register() must land in src without creating a source
+    if (ctx.to_is_world_object || GetSource(ctx.what_formid) != &src) return false;
+    // fetching a fake stage writes stage_to_sources; nothing fetches one while sourceMutex_ stays shared
+    DATA_SHARED_GUARD(src);
+    return !src.HasUnfetchedFakeStage();
+}
+
 void Manager::MarkDirty_(RE::TESObjectREFR* r) {
     if (!r) return;
     if (std::shared_lock lk(dirty_mtx_);
@@ -477,39 +532,139 @@ void Manager::MarkDirty_(RE::TESObjectREFR* r) {
     const auto h = r->GetHandle();
     if (!h) return;
     std::unique_lock lk(dirty_mtx_);
-    dirty_refs_[r->GetFormID()] = h;
+    const auto frame = dirty_frame_.load(std::memory_order_relaxed);
+    if (dirty_refs_.try_emplace(r->GetFormID(), DirtyRef{h, frame}).second) {
+        dirty_order_.emplace(frame, r->GetFormID());
+    }
 }
 
-void Manager::ProcessDirtyRefs_() {
-    std::unordered_map<RefID, RE::ObjectRefHandle> local;
+namespace {
+    // refs the player is looking at right now
+    std::array<RefID, 3> DirtyPriorityRefs(const RefID crosshair_ref) {
+        std::array<RefID, 3> refs{player_refid, crosshair_ref, 0};
+        if (const auto ui = RE::UI::GetSingleton(); ui && ui->IsMenuOpen(RE::ContainerMenu::MENU_NAME)) {
+            if (const auto menu = ui->GetMenu<RE::ContainerMenu>()) {
+                if (const auto container = RE::TESObjectREFR::LookupByHandle(menu->GetTargetRefHandle())) {
+                    refs[2] = container->GetFormID();
+                }
+            }
+        }
+        return refs;
+    }
+}
 
+void Manager::ProcessDirtyRefs_() {
+    AOT_PROFILE_SCOPE("Manager::ProcessDirtyRefs_");
+    dirty_frame_.fetch_add(1, std::memory_order_relaxed);
     {
-        std::unique_lock lk(dirty_mtx_);
+        std::shared_lock lk(dirty_mtx_);
         if (dirty_refs_.empty()) {
+            lk.unlock();
+            // the hooks and events of this frame only marked the read model
+            PublishReadModel();
             return;
         }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto priority_refs = DirtyPriorityRefs(crosshair_ref_.load(std::memory_order_relaxed));
 
+    std::vector<std::pair<RefID, DirtyRef>> batch;
+    {
+        std::unique_lock lk(dirty_mtx_);
         const std::size_t cap = std::max<std::size_t>(Settings::max_dirty_updates_min,
                                                       Settings::max_dirty_updates.load());
-        if (dirty_refs_.size() <= cap) {
-            local.swap(dirty_refs_);
-        } else {
-            local.reserve(cap);
-            std::size_t moved = 0;
-            for (auto it = dirty_refs_.begin(); it != dirty_refs_.end() && moved < cap;) {
-                const auto cur = it++;
-                local.insert(dirty_refs_.extract(cur));
-                ++moved;
-            }
+
+        batch.reserve(std::min(cap, dirty_refs_.size()));
+        const auto take = [&](const RefID refid) {
+            auto node = dirty_refs_.extract(refid);
+            dirty_order_.erase({node.mapped().marked_frame, refid});
+            batch.emplace_back(node.key(), node.mapped());
+        };
+        // the refs the player is looking at go ahead of any amount of waiting
+        for (const auto refid : priority_refs) {
+            if (batch.size() < cap && dirty_refs_.contains(refid)) take(refid);
+        }
+        // then the longest waiting: dirty_order_ is kept sorted as refs are marked, so nothing is ranked per frame
+        while (batch.size() < cap && !dirty_order_.empty()) {
+            take(dirty_order_.begin()->second);
         }
     }
 
-    for (const auto& h : local | std::views::values) {
-        if (const auto ref = h.get().get()) {
+    const auto budget = std::chrono::microseconds(std::clamp<uint32_t>(Settings::dirty_update_budget_us.load(),
+                                                                       Settings::dirty_update_budget_us_min,
+                                                                       Settings::dirty_update_budget_us_max));
+    size_t done = 0;
+    for (; done < batch.size(); ++done) {
+        if (done > 0 && std::chrono::steady_clock::now() - start >= budget) {
+            break;
+        }
+        if (const auto ref = batch[done].second.handle.get().get()) {
             SRC_UNIQUE_GUARD;
             UpdateRef(ref);
+            MarkReadModelDirty_(ref->GetFormID());
         }
     }
+
+    size_t backlog;
+    {
+        // put back what the budget did not cover, keeping the original frame so it keeps aging
+        std::unique_lock lk(dirty_mtx_);
+        for (size_t i = done; i < batch.size(); ++i) {
+            const auto& [refid, dirty] = batch[i];
+            if (auto [it, inserted] = dirty_refs_.try_emplace(refid, dirty); inserted) {
+                dirty_order_.emplace(dirty.marked_frame, refid);
+            } else if (dirty.marked_frame < it->second.marked_frame) {
+                dirty_order_.erase({it->second.marked_frame, refid});
+                it->second.marked_frame = dirty.marked_frame;
+                dirty_order_.emplace(dirty.marked_frame, refid);
+            }
+        }
+        backlog = dirty_refs_.size();
+    }
+
+    PublishReadModel();
+
+    const auto us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+    std::lock_guard lk(dirty_stats_mtx_);
+    dirty_frame_us_[dirty_frames_ % dirty_frame_us_.size()] = static_cast<uint32_t>(
+        std::min<uint64_t>(us, std::numeric_limits<uint32_t>::max()));
+    ++dirty_frames_;
+    dirty_refs_done_ += done;
+    if (done < batch.size()) ++dirty_over_budget_;
+    dirty_total_us_ += us;
+    dirty_max_us_ = std::max(dirty_max_us_, us);
+    dirty_backlog_ = backlog;
+}
+
+Manager::DirtyRefStats Manager::GetDirtyRefStats() {
+    std::lock_guard lk(dirty_stats_mtx_);
+    DirtyRefStats stats;
+    stats.frames = dirty_frames_;
+    stats.refs = dirty_refs_done_;
+    stats.over_budget = dirty_over_budget_;
+    stats.max_us = dirty_max_us_;
+    stats.backlog = dirty_backlog_;
+    if (dirty_frames_) {
+        stats.avg_us = static_cast<double>(dirty_total_us_) / static_cast<double>(dirty_frames_);
+        const auto n = std::min<size_t>(dirty_frames_, dirty_frame_us_.size());
+        std::vector<uint32_t> recent(dirty_frame_us_.begin(), dirty_frame_us_.begin() + static_cast<std::ptrdiff_t>(n));
+        const auto p99 = recent.begin() + static_cast<std::ptrdiff_t>(n * 99 / 100);
+        std::ranges::nth_element(recent, p99);
+        stats.p99_us = *p99;
+    }
+    return stats;
+}
+
+void Manager::ResetDirtyRefStats() {
+    std::lock_guard lk(dirty_stats_mtx_);
+    dirty_frame_us_.fill(0);
+    dirty_frames_ = 0;
+    dirty_refs_done_ = 0;
+    dirty_over_budget_ = 0;
+    dirty_total_us_ = 0;
+    dirty_max_us_ = 0;
 }
 
 void Manager::InstanceCountUpdate(const int32_t delta) { n_instances_.fetch_add(delta, std::memory_order_relaxed); }
@@ -608,6 +763,7 @@ void Manager::SplitWorldObjectStackIfNeeded_(Source& src, const UpdateCtx& ctx)
     while (v.size() > 1) {
         const auto inst_count = v[1].count;
         if (inst_count <= 0) {
+            src.UnindexSlot(ctx.to_refid, 1);
             v.erase(v.begin() + 1);
             continue;
         }
@@ -651,28 +807,131 @@ void Manager::PreDeleteRefStop(RefStop& a_ref_stop) {
     a_ref_stop.RemoveSound();
 }
 
+void Manager::EraseRefStop_(const RefID refid) {
+    _ref_stops_.erase(refid);
+    stop_schedule_.Erase(refid);
+    pending_features_.erase(refid);
+    wo_lods_.erase(refid);
+    ++refstops_version_;
+}
+
+std::optional<Manager::WOPlace> Manager::PlaceOf_(const RE::TESObjectREFR* ref) {
+    const auto cell = ref ? ref->GetParentCell() : nullptr;
+    if (!cell) return std::nullopt;
+    const auto ws = cell->IsInteriorCell() ? nullptr : ref->GetWorldspace();
+    return WOPlace{ref->GetPosition(), ws ? ws->GetFormID() : cell->GetFormID()};
+}
+
+Manager::WOTier Manager::TierOf_(const WOPlace& place, const std::optional<WOPlace>& player) {
+    if (!player) return WOTier::kNear;
+    if (place.space != player->space) return WOTier::kFar;
+    const auto dist2 = place.pos.GetSquaredDistance(player->pos);
+    if (dist2 <= Settings::lod_near_distance * Settings::lod_near_distance) return WOTier::kNear;
+    if (dist2 <= Settings::lod_far_distance * Settings::lod_far_distance) return WOTier::kMid;
+    return WOTier::kFar;
+}
+
+float Manager::TierStopTime_(const WOTier tier, const float stop_time) {
+    const float step = tier == WOTier::kFar
+                           ? Settings::lod_far_step
+                           : tier == WOTier::kMid
+                           ? Settings::lod_mid_step
+                           : 0.f;
+    if (step <= 0.f) return stop_time;
+    // the late update catches up through UpdateAllStages, so only the visible change is delayed
+    return std::ceil(stop_time / step) * step;
+}
+
+void Manager::SetWOPlace_(const RefID refid, const std::optional<WOPlace>& place) {
+    if (!place) return;
+    wo_lods_.insert_or_assign(refid, WOLod{*place, TierOf_(*place, lod_player_place_)});
+}
+
+void Manager::ScheduleStop_(const RefID refid, const float stop_time) {
+    const auto it = wo_lods_.find(refid);
+    stop_schedule_.Push(refid, TierStopTime_(it != wo_lods_.end() ? it->second.tier : WOTier::kNear, stop_time));
+}
+
+void Manager::RetierWOs_() {
+    const auto player = PlaceOf_(RE::PlayerCharacter::GetSingleton());
+    if (!player) return;
+
+    const auto moved = [&] {
+        const float step = Settings::lod_retier_distance;
+        return !lod_player_place_ || lod_player_place_->space != player->space ||
+               lod_player_place_->pos.GetSquaredDistance(player->pos) >= step * step;
+    };
+    {
+        QUE_SHARED_GUARD;
+        if (!moved()) return;
+    }
+
+    QUE_UNIQUE_GUARD;
+    if (!moved()) return;
+    lod_player_place_ = player;
+    for (auto& [refid, lod] : wo_lods_) {
+        const auto tier = TierOf_(lod.place, lod_player_place_);
+        if (tier == lod.tier) continue;
+        lod.tier = tier;
+        if (const auto it = _ref_stops_.find(refid); it != _ref_stops_.end() && stop_schedule_.Contains(refid)) {
+            stop_schedule_.Push(refid, TierStopTime_(tier, it->second.stop_time));
+        }
+    }
+}
+
+void Manager::RetierWO(const RE::TESObjectREFR* ref) {
+    if (!ref) return;
+    const auto refid = ref->GetFormID();
+    {
+        QUE_SHARED_GUARD;
+        if (!_ref_stops_.contains(refid)) return;
+    }
+
+    const auto place = PlaceOf_(ref);
+    QUE_UNIQUE_GUARD;
+    const auto it = _ref_stops_.find(refid);
+    if (it == _ref_stops_.end()) return;
+    SetWOPlace_(refid, place);
+    if (stop_schedule_.Contains(refid)) {
+        ScheduleStop_(refid, it->second.stop_time);
+    }
+}
+
 void Manager::UpdateLoop() {
+    AOT_PROFILE_SCOPE("Manager::UpdateLoop");
     if (!Settings::world_objects_evolve.load()) {
         ClearWOUpdateQueue();
-    } else if (QUE_UNIQUE_GUARD;
-        !queue_delete_.empty() || !Settings::placed_objects_evolve.load()) {
-        for (auto it = _ref_stops_.begin(); it != _ref_stops_.end();) {
-            if (const auto ref = it->second.GetRef();
-                queue_delete_.contains(it->first) ||
-                ref && !Settings::placed_objects_evolve.load() && Utils::WorldObject::IsPlacedObject(ref)) {
+    } else {
+        QUE_UNIQUE_GUARD;
+        for (const auto refid : queue_delete_) {
+            if (const auto it = _ref_stops_.find(refid); it != _ref_stops_.end()) {
                 PreDeleteRefStop(it->second);
-                it = _ref_stops_.erase(it);
-            } else ++it;
+                EraseRefStop_(refid);
+            }
         }
         queue_delete_.clear();
+        if (!Settings::placed_objects_evolve.load()) {
+            std::vector<RefID> placed;
+            for (auto& [refid, ref_stop] : _ref_stops_) {
+                if (const auto ref = ref_stop.GetRef(); ref && Utils::WorldObject::IsPlacedObject(ref)) {
+                    PreDeleteRefStop(ref_stop);
+                    placed.push_back(refid);
+                }
+            }
+            for (const auto refid : placed) {
+                EraseRefStop_(refid);
+            }
+        }
     }
 
     bool should_stop = false;
+    bool requests_changed = false;
     {
         QUE_SHARED_GUARD;
         if (_ref_stops_.empty()) {
             should_stop = true;
         }
+        requests_changed = refstops_version_ != scan_requests_version_;
     }
     if (should_stop) {
         Stop();
@@ -683,60 +942,111 @@ void Manager::UpdateLoop() {
 
     if (const auto ui = RE::UI::GetSingleton(); ui && ui->GameIsPaused()) return;
 
-    const auto ref_stops_copy = GetRefStops();
+    // scan requests only depend on which refs are queued and their stages, so rebuild them on change
+    if (requests_changed) {
+        {
+            QUE_SHARED_GUARD;
+            scan_requests_version_ = refstops_version_;
+        }
+        scan_requests_ = BuildCellScanRequests_(GetRefStops());
+    }
+    CellScanner::GetSingleton()->RequestRefresh(scan_requests_);
 
-    const auto scanReq = BuildCellScanRequests_(ref_stops_copy);
-    CellScanner::GetSingleton()->RequestRefresh(scanReq);
+    RetierWOs_();
+
+    // Only due refs are updated. Everything else keeps its stop time unless the modulator layout around
+    // the world objects changed since the last tick, in which case all of them are revalidated once.
+    bool revalidate_all = false;
+    if (const auto cache = CellScanner::GetSingleton()->GetCache()) {
+        revalidate_all = cache->fingerprint != modulator_fingerprint_;
+        modulator_fingerprint_ = cache->fingerprint;
+    }
 
     float curr_time = -1.0f;
+    std::vector<RefInfo> to_update;
     if (const auto cal = RE::Calendar::GetSingleton()) {
-        // make copy with only stops
         curr_time = cal->GetHoursPassed();
+
+        QUE_UNIQUE_GUARD;
         std::vector<RefID> ref_stops_due;
-        ref_stops_due.reserve(ref_stops_copy.size());
-        for (
-            QUE_UNIQUE_GUARD;
-            const auto& key : ref_stops_copy) {
-            auto it = _ref_stops_.find(key.ref_id);
-            if (it == _ref_stops_.end()) continue;
+        stop_schedule_.PopDue(curr_time, ref_stops_due);
 
-            if (auto& val = it->second; val.IsDue(curr_time)) {
-                ref_stops_due.push_back(key.ref_id);
-            } else if (const auto ref = val.GetRef()) {
+        to_update.reserve(revalidate_all ? _ref_stops_.size() : ref_stops_due.size());
+        for (const auto refid : ref_stops_due) {
+            if (auto it = _ref_stops_.find(refid); it != _ref_stops_.end()) {
+                to_update.push_back(it->second.ref_info);
+                PreDeleteRefStop(it->second);
+                EraseRefStop_(refid);
+            }
+        }
+
+        if (revalidate_all) {
+            for (const auto& val : _ref_stops_ | std::views::values) {
+                to_update.push_back(val.ref_info);
+            }
+        }
+
+        for (auto it = pending_features_.begin(); it != pending_features_.end();) {
+            const auto rit = _ref_stops_.find(*it);
+            if (rit == _ref_stops_.end()) {
+                it = pending_features_.erase(it);
+                continue;
+            }
+            if (const auto lit = wo_lods_.find(*it); lit != wo_lods_.end() && lit->second.tier != WOTier::kNear) {
+                ++it;
+                continue;
+            }
+            auto& val = rit->second;
+            if (const auto ref = val.GetRef()) {
                 val.ApplyTint(ref);
                 val.ApplyArtObject(ref);
                 val.ApplyShader(ref);
                 val.ApplySound();
             }
-        }
-
-        for (QUE_UNIQUE_GUARD; const auto refid : ref_stops_due) {
-            if (auto it = _ref_stops_.find(refid); it != _ref_stops_.end()) {
-                auto& val = it->second;
-                PreDeleteRefStop(val);
-                _ref_stops_.erase(it);
-            }
+            if (val.FeaturesApplied()) {
+                it = pending_features_.erase(it);
+            } else ++it;
         }
     }
 
-    //SKSE::GetTaskInterface()->AddTask([ref_stops_copy = std::move(ref_stops_copy)]() mutable {
+    //SKSE::GetTaskInterface()->AddTask([to_update = std::move(to_update)]() mutable {
     if (curr_time > 0.f) {
-        for (const auto& ref_info : ref_stops_copy) {
-            M->UpdateQueuedWO(ref_info, curr_time);
+        const auto modulations = ResolveWOModulations_(to_update);
+        for (const auto& ref_info : to_update) {
+            const auto it = modulations.find(ref_info.ref_id);
+            M->UpdateQueuedWO(ref_info, curr_time, it != modulations.end() ? &it->second : nullptr);
         }
     }
     //});
+
+    PublishReadModel();
 }
 
 void Manager::QueueWOUpdate(const RefStop& a_refstop) {
     if (!Settings::world_objects_evolve.load()) return;
 
+    // the cell and worldspace lookups stay outside the lock
+    const auto place = PlaceOf_(a_refstop.ref_info.GetRef());
+
     bool needStart;
     {
         const auto refid = a_refstop.ref_info.ref_id;
         QUE_UNIQUE_GUARD;
-        if (auto [it, inserted] = _ref_stops_.try_emplace(refid, a_refstop); !inserted) {
-            it->second.Update(a_refstop);
+        auto [it, inserted] = _ref_stops_.try_emplace(refid, a_refstop);
+        auto& val = it->second;
+        const float old_stop_time = val.stop_time;
+        if (!inserted) {
+            val.Update(a_refstop);
+        }
+        if (inserted || val.stop_time != old_stop_time) {
+            ++refstops_version_;
+        }
+        // every (re)schedule takes the current place, so an object moved since it was queued is not left on the
+        // grid of its old tier
+        SetWOPlace_(refid, place);
+        ScheduleStop_(refid, val.stop_time);
+        if (!val.FeaturesApplied()) {
+            pending_features_.insert(refid);
         }
         needStart = !isRunning();
     }
@@ -814,6 +1124,7 @@ Source* Manager::MakeSource(const FormID source_formid, const DefaultSettings* s
     auto [it, inserted] = sources.try_emplace(source_id, std::move(new_source));
     if (inserted) {
         IndexSourceStages(*it->second);
+        MarkReadModelSourcesDirty_();
     }
     return it->second.get();
 }
@@ -848,6 +1159,8 @@ void Manager::CleanUpSourceData(Source* src) {
     }
 
     src->CleanUpData();
+    // may have marked the source unhealthy
+    MarkReadModelSourcesDirty_();
 
     for (const auto loc : previous_locations) {
         UpdateLocationIndexForSource(*src, loc);
@@ -856,7 +1169,12 @@ void Manager::CleanUpSourceData(Source* src) {
 
 void Manager::CleanUpSourceData(Source* src, const RefID a_loc) {
     if (!src) return;
+    const bool was_healthy = src->IsHealthy();
     src->CleanUpData(a_loc);
+    // the source summaries only change if this marked the source unhealthy
+    if (was_healthy && !src->IsHealthy()) {
+        MarkReadModelSourcesDirty_();
+    }
     UpdateLocationIndexForSource(*src, a_loc);
 }
 
@@ -872,8 +1190,6 @@ Source* Manager::GetSource(const FormID some_formid) {
         }
     }
 
-    if (do_not_register.contains(some_formid)) return nullptr;
-
     return nullptr;
 }
 
@@ -1188,19 +1504,76 @@ void Manager::UpdateInventory(const RefInfo& a_info, const InvMap& inv) {
     SyncWithInventory(a_info, inv);
 
     const auto curr = RE::Calendar::GetSingleton()->GetHoursPassed();
-    for (;;) {
-        auto next = GetNextUpdateTime(a_info);
-        if (!next) break;
-        const float base = *next;
-        if (!std::isfinite(base)) break;
-        const float t = std::nextafterf(base, std::numeric_limits<float>::infinity());
-        if (t >= curr) break;
-        if (!UpdateInventory(a_info, t, inv)) break;
+    if (Settings::stepwise_catch_up.load()) {
+        // verification mode: one full pass over the location per stage boundary
+        for (;;) {
+            auto next = GetNextUpdateTime(a_info);
+            if (!next) break;
+            const float base = *next;
+            if (!std::isfinite(base)) break;
+            const float t = std::nextafterf(base, std::numeric_limits<float>::infinity());
+            if (t >= curr) break;
+            if (!UpdateInventory(a_info, t, inv)) break;
+        }
+    } else {
+        FastForwardInventory(a_info, curr, inv);
     }
 
     UpdateInventory(a_info, curr, inv);
 }
 
+void Manager::FastForwardInventory(const RefInfo& a_info, const float curr_time, const InvMap& inv) {
+    const auto refid = a_info.ref_id;
+
+    // Decayed/transformed items registered in a pass start in the past, so they get their own catch-up in the
+    // next pass. Each pass moves one step down a decay chain, and a chain without cycles visits every source at
+    // most once, so one pass per source is enough; only a cycle of decay products runs out of passes.
+    const size_t max_passes = sources.size() + 1;
+    for (size_t pass = 0; pass < max_passes; ++pass) {
+        const auto lit = loc_to_sources.find(refid);
+        if (lit == loc_to_sources.end()) {
+            return;
+        }
+        const std::vector<FormID> candidate_sources(lit->second.begin(), lit->second.end());
+
+        bool registered = false;
+        for (const auto src_formid : candidate_sources) {
+            const auto sit = sources.find(src_formid);
+            if (sit == sources.end()) {
+                RemoveLocationIndex(refid, src_formid);
+                continue;
+            }
+
+            auto& source = *sit->second;
+            if (!source.IsHealthy()) {
+                continue;
+            }
+
+            const auto updates = source.FastForwardInventory(a_info, curr_time, inv);
+            if (updates.empty()) {
+                continue;
+            }
+
+            CleanUpSourceData(&source, refid);
+
+            for (const auto& update : updates) {
+                if (ApplyEvolutionInInventory(a_info, update.count, update.oldstage->formid,
+                                              update.newstage->formid) &&
+                    source.IsDecayedItem(update.newstage->formid)) {
+                    Register(update.newstage->formid, update.count, a_info, update.update_time, inv);
+                    registered = true;
+                }
+            }
+        }
+
+        if (!registered) {
+            return;
+        }
+    }
+    logger::warn("FastForwardInventory: {:x} still had decayed items to catch up after {} passes (decay cycle?); "
+                 "they continue from their current stage on the next update.", refid, max_passes);
+}
+
 void Manager::SyncWithInventory(const RefInfo& a_info, const InvMap& inv) {
     const RefID loc = a_info.ref_id;
     const bool needHandling = locs_to_be_handled.contains(loc);
@@ -1224,13 +1597,13 @@ void Manager::SyncWithInventory(const RefInfo& a_info, const InvMap& inv) {
             if (sit == sources.end()) continue;
             auto& src = *sit->second;
 
-            auto dit = src.data.find(loc);
-            if (dit == src.data.end()) continue;
+            const auto index = src.GetStageIndex(loc);
+            if (!index) continue;
 
-            for (auto& inst : dit->second) {
-                if (inst.xtra.is_decayed || inst.count <= 0) continue;
-                reg_total[inst.xtra.form_id] += inst.count;
-                if (inst.xtra.is_fake) reg_has_fake[inst.xtra.form_id] = true;
+            for (const auto& [fid, slots] : *index) {
+                if (slots.total <= 0) continue;
+                reg_total[fid] += slots.total;
+                if (slots.has_fake) reg_has_fake[fid] = true;
             }
         }
     }
@@ -1287,23 +1660,28 @@ void Manager::SyncWithInventory(const RefInfo& a_info, const InvMap& inv) {
             auto dit = src.data.find(loc);
             if (dit == src.data.end()) continue;
 
-            for (auto& inst : dit->second) {
+            for (uint32_t i = 0; i < dit->second.size(); ++i) {
+                auto& inst = dit->second[i];
                 if (inst.xtra.is_decayed || inst.count <= 0) continue;
 
                 const FormID fid = inst.xtra.form_id;
+                const auto indexed = Source::IndexedStateOf(inst);
 
                 if (!inv_fids.contains(fid)) {
                     // registry item not present in inventory
                     if (needHandling && inst.xtra.is_fake)
                         AddItem(a_info, {0, 0}, fid, inst.count);
-                    else
+                    else {
                         inst.count = 0;
+                        src.ReindexSlot(loc, i, indexed);
+                    }
                     continue;
                 }
 
                 if (auto it = remove_from_reg.find(fid); it != remove_from_reg.end() && it->second > 0) {
                     const Count take = std::min<Count>(inst.count, it->second);
                     inst.count -= take;
+                    src.ReindexSlot(loc, i, indexed);
                     it->second -= take;
                     if (it->second == 0) remove_from_reg.erase(it);
                 }
@@ -1315,14 +1693,104 @@ void Manager::SyncWithInventory(const RefInfo& a_info, const InvMap& inv) {
 }
 
 
-void Manager::UpdateQueuedWO(const RefInfo& ref_info, const float curr_time) {
+WorldModulationMap Manager::ResolveWOModulations_(const std::vector<RefInfo>& to_update) {
+    AOT_PROFILE_SCOPE("Manager::ResolveWOModulations_");
+    WorldModulationMap out;
+    if (to_update.empty()) return out;
+
+    struct Group {
+        std::vector<RefID> refids;
+        std::vector<const RE::TESObjectREFR*> refs;
+        std::vector<WorldModulation> modulations;
+    };
+    // (transformer candidates, delayer candidates) -> objects that share them, whatever their source and stage
+    std::map<std::pair<std::vector<FormID>, std::vector<FormID>>, Group> groups;
+
+    {
+        SRC_SHARED_GUARD;
+        std::pair<std::vector<FormID>, std::vector<FormID>> key;
+        for (const auto& ref_info : to_update) {
+            const auto ref = ref_info.GetRef();
+            if (!ref || !ref->GetBaseObject()) continue;
+            const auto refid = ref_info.ref_id;
+
+            // same pick as BuildLocationView_
+            for (const auto src_formid : GetLocationSources_(refid)) {
+                const auto sit = sources.find(src_formid);
+                if (sit == sources.end() || !sit->second || !sit->second->IsHealthy()) continue;
+                const auto& src = *sit->second;
+                DATA_SHARED_GUARD(src);
+                const auto dit = src.data.find(refid);
+                if (dit == src.data.end() || dit->second.empty()) continue;
+                const auto& inst = dit->second.front();
+                if (inst.count <= 0) continue;
+
+                key.first.clear();
+                key.second.clear();
+                src.CollectWorldCandidates(inst.no, key.first, key.second);
+                auto& group = groups[key];
+                group.refids.push_back(refid);
+                group.refs.push_back(ref);
+                group.modulations.push_back({.source = src.formid, .no = inst.no});
+                break;
+            }
+        }
+    }
+
+    std::vector<FormID> found;
+    for (auto& [candidates, group] : groups) {
+        const auto n = group.refs.size();
+
+        found.assign(n, 0);
+        Source::SearchNearbyModulatorsBatch(candidates.first, group.refs, found);
+        for (size_t i = 0; i < n; ++i) {
+            group.modulations[i].transformer = found[i];
+            // a transformer wins, so its objects skip the delayer join
+            if (found[i]) group.refs[i] = nullptr;
+        }
+
+        found.assign(n, 0);
+        Source::SearchNearbyModulatorsBatch(candidates.second, group.refs, found);
+        for (size_t i = 0; i < n; ++i) {
+            group.modulations[i].delayer = found[i];
+            out.emplace(group.refids[i], group.modulations[i]);
+        }
+    }
+
+    return out;
+}
+
+void Manager::UpdateQueuedWO(const RefInfo& ref_info, const float curr_time, const WorldModulation* a_modulation) {
     // Called from UpdateLoop task.
 
     const auto refid = ref_info.ref_id;
+    RE::TESObjectREFR* ref = ref_info.GetRef();
+    std::vector<WORegistration> deferred;
+    bool confined = false;
+
+    // A world object tracked by a single source only needs that source's lock, so hook updates of other sources
+    // can run alongside it.
+    {
+        SRC_SHARED_GUARD;
+        if (const auto source = GetConfinedWOSource_(ref)) {
+            DATA_UNIQUE_GUARD(*source);
+            EvolveWO_(*source, ref, curr_time, deferred, a_modulation);
+            confined = true;
+        }
+    }
+    if (confined) {
+        if (!deferred.empty()) {
+            SRC_UNIQUE_GUARD;
+            for (const auto& [formid, count, loc, time] : deferred) {
+                Register(formid, count, loc, time);
+            }
+        }
+        return;
+    }
 
     SRC_UNIQUE_GUARD;
+    MarkReadModelDirty_(refid);
 
-    RE::TESObjectREFR* ref = ref_info.GetRef();
     if (!ref) {
         QUE_UNIQUE_GUARD;
         queue_delete_.insert(refid);
@@ -1361,12 +1829,50 @@ void Manager::UpdateQueuedWO(const RefInfo& ref_info, const float curr_time) {
     // Handle base change the same way UpdateWO does:
     HandleWOBaseChange(ref);
 
-    // Re-fetch after HandleWOBaseChange because it may have zeroed the instance
+    EvolveWO_(*source, ref, curr_time, deferred, a_modulation);
+    for (const auto& [formid, n, loc, time] : deferred) {
+        Register(formid, n, loc, time);
+    }
+}
+
+Source* Manager::GetConfinedWOSource_(RE::TESObjectREFR* ref) {
+    if (!ref || !RefIsUpdatable(ref)) return nullptr;
+    const auto base = ref->GetObjectReference();
+    if (!base || base->IsDynamicForm()) return nullptr;
+
+    const auto refid = ref->GetFormID();
+    const auto loc_sources = GetLocationSources_(refid);
+    if (loc_sources.size() != 1) return nullptr;
+
+    const auto sit = sources.find(loc_sources.front());
+    if (sit == sources.end() || !sit->second || !sit->second->IsHealthy()) return nullptr;
+    auto& src = *sit->second;
+
+    // anything HandleWOBaseChange would have to fix goes through the exclusive path, and so does a stage change
+    // that could fetch a fake stage (see IsConfinedTransfer_)
+    DATA_SHARED_GUARD(src);
+    if (src.HasUnfetchedFakeStage()) return nullptr;
+    const auto it = src.data.find(refid);
+    if (it == src.data.end() || it->second.size() != 1) return nullptr;
+    const auto& inst = it->second.front();
+    if (inst.count <= 0) return nullptr;
+    const auto bound_expected = src.IsFakeStage(inst.no) ? src.GetBoundObject() : inst.GetBound();
+    if (!bound_expected || bound_expected->GetFormID() != base->GetFormID()) return nullptr;
+
+    return &src;
+}
+
+void Manager::EvolveWO_(Source& src, RE::TESObjectREFR* ref, const float curr_time,
+                        std::vector<WORegistration>& a_deferred, const WorldModulation* a_modulation) {
+    const auto refid = ref->GetFormID();
+    MarkReadModelDirty_(refid);
+
+    // Re-fetch: HandleWOBaseChange may have zeroed the instance, or it moved since the confined check
     {
-        if (const auto it = source->data.find(refid);
-            it == source->data.end() || it->second.empty() || it->second.front().count <= 0) {
-            if (it == source->data.end() || it->second.empty()) {
-                UpdateLocationIndexForSource(*source, refid);
+        if (const auto it = src.data.find(refid);
+            it == src.data.end() || it->second.empty() || it->second.front().count <= 0) {
+            if (it == src.data.end() || it->second.empty()) {
+                UpdateLocationIndexForSource(src, refid);
             }
             QUE_UNIQUE_GUARD;
             queue_delete_.insert(refid);
@@ -1374,45 +1880,45 @@ void Manager::UpdateQueuedWO(const RefInfo& ref_info, const float curr_time) {
         }
     }
 
-    if (const auto updated_stages = source->UpdateAllStages(refid, curr_time);
+    if (const auto updated_stages = src.UpdateAllStages(refid, curr_time);
         !updated_stages.empty()) {
         if (updated_stages.size() > 1) {
             logger::error("UpdateQueuedWO: Multiple updates for the same ref.");
         }
         const auto& update = updated_stages.front();
-        const auto src_bound = source->IsFakeStage(update.newstage->no) ? source->GetBoundObject() : nullptr;
+        const auto src_bound = src.IsFakeStage(update.newstage->no) ? src.GetBoundObject() : nullptr;
         ApplyStageInWorld(ref, *update.newstage, src_bound);
-        if (source->IsDecayedItem(update.newstage->formid)) {
-            Register(update.newstage->formid, update.count, refid, update.update_time);
+        if (src.IsDecayedItem(update.newstage->formid)) {
+            a_deferred.push_back({update.newstage->formid, update.count, refid, update.update_time});
         }
     }
 
-    const auto it = source->data.find(refid);
-    if (it == source->data.end() || it->second.empty()) {
-        Register(ref->GetBaseObject()->GetFormID(), ref->extraList.GetCount(), refid, curr_time);
+    const auto it = src.data.find(refid);
+    if (it == src.data.end() || it->second.empty()) {
+        a_deferred.push_back({ref->GetBaseObject()->GetFormID(), ref->extraList.GetCount(), refid, curr_time});
         return;
     }
 
     auto& wo_inst = it->second.front();
     if (wo_inst.count <= 0) {
-        source->data.erase(it);
-        UpdateLocationIndexForSource(*source, refid);
-        Register(ref->GetBaseObject()->GetFormID(), ref->extraList.GetCount(), refid, curr_time);
+        src.data.erase(it);
+        UpdateLocationIndexForSource(src, refid);
+        a_deferred.push_back({ref->GetBaseObject()->GetFormID(), ref->extraList.GetCount(), refid, curr_time});
         return;
     }
 
     if (wo_inst.xtra.is_fake) {
-        ApplyStageInWorld(ref, source->GetStage(wo_inst.no), source->GetBoundObject());
+        ApplyStageInWorld(ref, src.GetStage(wo_inst.no), src.GetBoundObject());
     }
 
-    source->UpdateTimeModulationInWorld(ref, wo_inst, curr_time);
-    if (const auto next_update = source->GetNextUpdateTime(&wo_inst); next_update > curr_time) {
+    src.UpdateTimeModulationInWorld(ref, wo_inst, curr_time, a_modulation);
+    if (const auto next_update = src.GetNextUpdateTime(&wo_inst); next_update > curr_time) {
         RefStop a_ref_stop(refid);
-        UpdateRefStop(*source, wo_inst, a_ref_stop, next_update);
+        UpdateRefStop(src, wo_inst, a_ref_stop, next_update);
         QueueWOUpdate(a_ref_stop);
     }
 
-    CleanUpSourceData(source, refid);
+    CleanUpSourceData(&src, refid);
 }
 
 void Manager::UpdateWO(RE::TESObjectREFR* ref) {
@@ -1522,7 +2028,9 @@ bool Manager::DeRegisterRef(const RefID refid) {
         if (auto it = source.data.find(refid); it != source.data.end()) {
             M->InstanceCountUpdate(-static_cast<int>(it->second.size()));
             source.data.erase(it);
+            source.ReindexLocation(refid);
             RemoveLocationIndex(refid, source.formid);
+            MarkReadModelDirty_(refid);
             found = true;
         }
     }
@@ -1535,11 +2043,15 @@ void Manager::ClearWOUpdateQueue() {
         PreDeleteRefStop(val);
     }
     _ref_stops_.clear();
+    stop_schedule_.Clear();
+    pending_features_.clear();
+    wo_lods_.clear();
+    ++refstops_version_;
 }
 
 void Manager::Register(const FormID some_formid, const Count count, const RefID location_refid,
                        const Duration register_time) {
-    if (do_not_register.contains(some_formid)) {
+    if (IsDoNotRegister_(some_formid)) {
         return;
     }
     if (!some_formid) {
@@ -1574,12 +2086,12 @@ void Manager::Register(const FormID some_formid, const Count count, const RefID
     // make new registry
     Source* const src = ForceGetSource(some_formid); // also saves it to sources if it was created new
     if (!src) {
-        do_not_register.insert(some_formid);
+        AddDoNotRegister_(some_formid);
         return;
     }
     if (!src->IsStage(some_formid)) {
         logger::critical("Register: some_formid is not a stage.");
-        do_not_register.insert(some_formid);
+        AddDoNotRegister_(some_formid);
         return;
     }
 
@@ -1603,7 +2115,7 @@ void Manager::Register(const FormID some_formid, const Count count, const RefID
 
 void Manager::Register(const FormID some_formid, const Count count, const RefInfo& ref_info,
                        const Duration register_time, const InvMap& a_inv) {
-    if (do_not_register.contains(some_formid)) {
+    if (IsDoNotRegister_(some_formid)) {
         return;
     }
     if (!some_formid) {
@@ -1636,12 +2148,12 @@ void Manager::Register(const FormID some_formid, const Count count, const RefInf
     // make new registry
     Source* const src = ForceGetSource(some_formid); // also saves it to sources if it was created new
     if (!src) {
-        do_not_register.insert(some_formid);
+        AddDoNotRegister_(some_formid);
         return;
     }
     if (!src->IsStage(some_formid)) {
         logger::critical("Register: some_formid is not a stage.");
-        do_not_register.insert(some_formid);
+        AddDoNotRegister_(some_formid);
         return;
     }
 
@@ -1665,7 +2177,12 @@ void Manager::HandleCraftingEnter(const unsigned int bench_type) {
         return;
     }
 
-    UpdateRef(player_ref);
+    QueueManager::GetSingleton()->DrainUpdates();
+    {
+        SRC_UNIQUE_GUARD;
+        UpdateRef(player_ref);
+        MarkReadModelDirty_(player_ref->GetFormID());
+    }
     ListenGuard lg(Hooks::listen_disable_depth);
 
     const auto& q_form_types = Settings::qform_bench_map.at(bench_type);
@@ -1677,6 +2194,7 @@ void Manager::HandleCraftingEnter(const unsigned int bench_type) {
     for (SRC_SHARED_GUARD; auto& a_source : sources | std::views::values) {
         auto& src = *a_source;
         if (!src.IsHealthy()) continue;
+        DATA_SHARED_GUARD(src);
         if (!src.data.contains(player_refid)) continue;
 
         if (!std::ranges::contains(q_form_types, src.qFormType)) {
@@ -1799,8 +2317,13 @@ void Manager::Update(RE::TESObjectREFR* from, RE::TESObjectREFR* to, const RE::T
 }
 
 void Manager::UpdateNow(RE::TESObjectREFR* a_ref) {
-    SRC_UNIQUE_GUARD;
-    return UpdateRef(a_ref);
+    // hook transfers still in the ring would otherwise be applied on top of the synced inventory
+    QueueManager::GetSingleton()->DrainUpdates();
+    {
+        SRC_UNIQUE_GUARD;
+        UpdateRef(a_ref);
+        if (a_ref) MarkReadModelDirty_(a_ref->GetFormID());
+    }
 }
 
 void Manager::SwapWithStage(RE::TESObjectREFR* wo_ref) {
@@ -1811,7 +2334,7 @@ void Manager::SwapWithStage(RE::TESObjectREFR* wo_ref) {
 
     RE::TESBoundObject* toSwap;
     {
-        SRC_SHARED_GUARD;
+        SRC_UNIQUE_GUARD;
         if (const auto st_inst = GetWOStageInstance(wo_ref)) {
             toSwap = st_inst->GetBound();
         } else {
@@ -1831,8 +2354,13 @@ void Manager::Reset() {
         for (const auto& src : sources | std::views::values) src->Reset();
         sources.clear();
         stage_to_sources.clear();
-        loc_to_sources.clear();
+        {
+            std::lock_guard lock(registryMutex_);
+            loc_to_sources.clear();
+        }
+        MarkReadModelAllDirty_();
     }
+    PublishReadModel();
 
     // external_favs.clear();         // we will update this in ReceiveData
     handle_crafting_instances.clear();
@@ -1848,8 +2376,16 @@ void Manager::Reset() {
 }
 
 bool Manager::HandleFormDelete(const FormID a_refid) {
-    SRC_UNIQUE_GUARD;
-    return DeRegisterRef(a_refid);
+    {
+        SRC_UNIQUE_GUARD;
+        if (!DeRegisterRef(a_refid)) {
+            return false;
+        }
+        // the ticker only visits due refstops, so drop a deleted ref's stop explicitly
+        QUE_UNIQUE_GUARD;
+        queue_delete_.insert(a_refid);
+    }
+    return true;
 }
 
 void Manager::SendData() {
@@ -1857,6 +2393,8 @@ void Manager::SendData() {
     Print();
     Clear();
 
+    QueueManager::GetSingleton()->DrainUpdates();
+
     if (QueueManager::GetSingleton()->HasPendingMoveItemTasks()) {
         logger::critical("SendData: There are pending move item tasks!");
     }
@@ -1864,12 +2402,14 @@ void Manager::SendData() {
     for (SRC_UNIQUE_GUARD; auto& src : sources | std::views::values) {
         CleanUpSourceData(src.get());
     }
+    PublishReadModel();
 
     const auto player_inv = player_ref->GetInventory();
     int n_instances = 0;
     SRC_SHARED_GUARD;
     for (const auto& src : sources | std::views::values) {
         const auto& source = *src;
+        DATA_SHARED_GUARD(source);
         if (source.GetStageDuration(0) >= 10000.f) {
             if (source.settings.transformers_order.size() == 0 && source.settings.delayers_order.size() == 0) {
                 continue;
@@ -1892,6 +2432,12 @@ void Manager::SendData() {
         }
     }
     logger::info("Data sent. Number of instances: {}", n_instances);
+
+    const auto report = GetMemoryReport_();
+    logger::info("Instance memory: {} B/instance ({} B/instance with inline editor IDs), {} instances, "
+                 "{} interned editor IDs in {} B",
+                 report.bytes_per_instance, report.legacy_bytes_per_instance, report.n_instances,
+                 report.n_editor_ids, report.editor_id_pool_bytes);
 }
 
 void Manager::HandleLoc(RE::TESObjectREFR* loc_ref) {
@@ -1977,7 +2523,7 @@ StageInstance* Manager::RegisterAtReceiveData(const FormID source_formid, const
     StageInstance new_instance(st_plain.start_time, stage_no, st_plain.count);
     const auto& stage_temp = src->GetStage(stage_no);
     new_instance.xtra.form_id = stage_temp.formid;
-    new_instance.xtra.editor_id = clib_util::editorID::get_editorID(stage_temp.GetBound());
+    new_instance.xtra.editor_id = Utils::Types::InternEditorID(stage_temp.GetBound());
     new_instance.xtra.crafting_allowed = stage_temp.crafting_allowed;
     if (src->IsFakeStage(stage_no)) new_instance.xtra.is_fake = true;
 
@@ -2082,8 +2628,12 @@ void Manager::ReceiveData() {
     }
 
     HandleLoc(player_ref);
-    SRC_UNIQUE_GUARD;
-    locs_to_be_handled.erase(player_refid);
+    {
+        SRC_UNIQUE_GUARD;
+        locs_to_be_handled.erase(player_refid);
+        MarkReadModelAllDirty_();
+    }
+    PublishReadModel();
     Print();
 
     logger::info("--------Data received. Number of instances: {}---------", GetNInstancesFast());
@@ -2097,71 +2647,265 @@ void Manager::Print() {
     }*/
 }
 
-std::vector<Source> Manager::GetSources() {
-    SRC_SHARED_GUARD;
-    std::vector<Source> sources_copy;
-    sources_copy.reserve(sources.size());
-    for (const auto& src : sources | std::views::values) {
-        sources_copy.push_back(*src);
+void Manager::MarkReadModelDirty_(const RefID loc) {
+    if (!loc) return;
+    std::lock_guard lock(registryMutex_);
+    read_model_pending_.store(true, std::memory_order_release);
+    if (read_model_all_dirty_) return;
+    read_model_dirty_.insert(loc);
+}
+
+void Manager::MarkReadModelAllDirty_() {
+    std::lock_guard lock(registryMutex_);
+    read_model_all_dirty_ = true;
+    read_model_sources_dirty_ = true;
+    read_model_dirty_.clear();
+    read_model_pending_.store(true, std::memory_order_release);
+}
+
+void Manager::MarkReadModelSourcesDirty_() {
+    std::lock_guard lock(registryMutex_);
+    read_model_sources_dirty_ = true;
+    read_model_pending_.store(true, std::memory_order_release);
+}
+
+ReadModel::LocationView Manager::BuildLocationView_(const RefID loc, const float curr_time) {
+    ReadModel::LocationView view;
+
+    bool picked = false;
+    for (const auto src_formid : GetLocationSources_(loc)) {
+        const auto sit = sources.find(src_formid);
+        if (sit == sources.end() || !sit->second || !sit->second->IsHealthy()) continue;
+        const auto& src = *sit->second;
+        DATA_SHARED_GUARD(src);
+        const auto dit = src.data.find(loc);
+        if (dit == src.data.end()) continue;
+        for (const auto& inst : dit->second) {
+            view.rows.push_back(src.ProjectRow(inst, loc, curr_time));
+        }
+
+        // same pick as GetSourceByLocation, which the world object update path uses
+        if (!picked && std::ranges::any_of(dit->second, [](const StageInstance& inst) { return inst.count > 0; })) {
+            picked = true;
+            if (const auto& inst = dit->second.front(); inst.count > 0) {
+                view.scan_bases = CollectScanBases_(src, inst.no);
+            }
+        }
     }
-    return sources_copy;
+
+    return view;
 }
 
-std::vector<Source> Manager::GetSourcesByStageAndOwner(const FormID stage_formid, const RefID location_id) {
-    std::vector<Source> out;
-    if (!stage_formid || !location_id) {
-        return out;
+void Manager::PublishReadModel_() {
+    AOT_PROFILE_SCOPE("Manager::PublishReadModel_");
+    std::lock_guard lock(readModelMutex_);
+
+    // take the marks; anything marked while building stays for the next publish
+    std::unordered_set<RefID> dirty;
+    bool all_dirty;
+    bool sources_dirty;
+    std::vector<RefID> all_locations;
+    {
+        std::lock_guard reg_lock(registryMutex_);
+        read_model_pending_.store(false, std::memory_order_relaxed);
+        if (!read_model_all_dirty_ && !read_model_sources_dirty_ && read_model_dirty_.empty()) return;
+        dirty.swap(read_model_dirty_);
+        all_dirty = std::exchange(read_model_all_dirty_, false);
+        sources_dirty = std::exchange(read_model_sources_dirty_, false);
+        if (all_dirty) {
+            all_locations.reserve(loc_to_sources.size());
+            for (const auto loc : loc_to_sources | std::views::keys) {
+                all_locations.push_back(loc);
+            }
+        }
     }
 
-    SRC_SHARED_GUARD;
+    float curr_time = 0.f;
+    if (const auto cal = RE::Calendar::GetSingleton()) {
+        curr_time = cal->GetHoursPassed();
+    }
+
+    const auto prev = read_model_.load(std::memory_order_acquire);
+    auto next = std::make_shared<ReadModel>();
+    next->epoch = prev->epoch + 1;
+
+    if (all_dirty) {
+        std::array<ReadModel::Shard, ReadModel::n_shards> shards;
+        for (const auto loc : all_locations) {
+            auto view = BuildLocationView_(loc, curr_time);
+            if (view.rows.empty()) continue;
+            auto& shard = shards[ReadModel::ShardOf(loc)];
+            shard.n_instances += view.rows.size();
+            shard.locations.emplace(loc, std::make_shared<const ReadModel::LocationView>(std::move(view)));
+        }
+        for (size_t i = 0; i < ReadModel::n_shards; ++i) {
+            next->shards[i] = std::make_shared<const ReadModel::Shard>(std::move(shards[i]));
+        }
+    } else {
+        next->shards = prev->shards;
+
+        std::array<std::vector<RefID>, ReadModel::n_shards> dirty_by_shard;
+        for (const auto loc : dirty) {
+            dirty_by_shard[ReadModel::ShardOf(loc)].push_back(loc);
+        }
+
+        // copy-on-write: only the touched shards are copied, and only their dirty locations are re-projected
+        for (size_t i = 0; i < ReadModel::n_shards; ++i) {
+            if (dirty_by_shard[i].empty()) continue;
+            auto shard = prev->shards[i]
+                             ? std::make_shared<ReadModel::Shard>(*prev->shards[i])
+                             : std::make_shared<ReadModel::Shard>();
+            for (const auto loc : dirty_by_shard[i]) {
+                if (const auto it = shard->locations.find(loc); it != shard->locations.end()) {
+                    shard->n_instances -= it->second->rows.size();
+                    shard->locations.erase(it);
+                }
+                auto view = BuildLocationView_(loc, curr_time);
+                if (view.rows.empty()) continue;
+                shard->n_instances += view.rows.size();
+                shard->locations.emplace(loc, std::make_shared<const ReadModel::LocationView>(std::move(view)));
+            }
+            next->shards[i] = std::move(shard);
+        }
+    }
+
+    if (sources_dirty || !prev->summaries) {
+        auto summaries = std::make_shared<std::vector<SourceSummary>>();
+        summaries->reserve(sources.size());
+        for (const auto& src : sources | std::views::values) {
+            if (!src || !src->IsHealthy()) continue;
+            DATA_SHARED_GUARD(*src);
+            summaries->push_back(src->Summarize());
+        }
+        next->summaries = std::move(summaries);
+    } else {
+        next->summaries = prev->summaries;
+    }
 
-    const auto lit = loc_to_sources.find(location_id);
-    const size_t nLoc = (lit == loc_to_sources.end()) ? 0 : lit->second.size();
-    if (nLoc == 0) {
-        return out;
+    for (const auto& shard : next->shards) {
+        if (shard) next->n_instances += shard->n_instances;
     }
 
-    const auto stIt = stage_to_sources.find(stage_formid);
-    const bool haveStageSet = (stIt != stage_to_sources.end() && !stIt->second.empty());
-    const size_t nStage = haveStageSet ? stIt->second.size() : SIZE_MAX;
+    read_model_.store(std::move(next), std::memory_order_release);
+}
 
-    out.reserve(haveStageSet ? std::min(nLoc, nStage) : nLoc);
+void Manager::PublishReadModel() {
+    if (!read_model_pending_.load(std::memory_order_acquire)) return;
+    {
+        // a publish already took the marks that raised the flag; settle it here so the frame skips sourceMutex_
+        std::lock_guard lock(registryMutex_);
+        if (!read_model_all_dirty_ && !read_model_sources_dirty_ && read_model_dirty_.empty()) {
+            read_model_pending_.store(false, std::memory_order_relaxed);
+            return;
+        }
+    }
+    SRC_SHARED_GUARD;
+    PublishReadModel_();
+}
 
-    auto try_add_if_match = [&](const FormID src_formid) {
-        const auto sit = sources.find(src_formid);
-        if (sit == sources.end()) return;
+void Manager::QueryStageRows(const FormID stage_formid, const RefID location_id,
+                             std::vector<StageRow>& a_out) const {
+    a_out.clear();
+    if (!stage_formid || !location_id) {
+        return;
+    }
 
-        Source* src = sit->second.get();
-        if (!src || !src->IsHealthy()) return;
+    const auto model = GetReadModel();
+    const auto view = model->Find(location_id);
+    if (!view) {
+        return;
+    }
 
-        const auto dit = src->data.find(location_id);
-        if (dit == src->data.end() || dit->second.empty()) return;
+    for (const auto& row : view->rows) {
+        if (row.count <= 0 || row.is_decayed) continue;
+        if (row.form_id != stage_formid) continue;
+        a_out.push_back(row);
+    }
+}
 
-        for (const auto& inst : dit->second) {
-            if (inst.count > 0 && inst.xtra.form_id == stage_formid) {
-                out.push_back(*src);
-                return;
+size_t Manager::QueryInstancePage(const ReadModel& a_model, const size_t a_offset, const size_t a_limit,
+                                  std::vector<StageRow>& a_out) {
+    a_out.clear();
+
+    size_t total = 0;
+    for (const auto& shard : a_model.shards) {
+        if (!shard) continue;
+        // whole shard before or after the page: only count it
+        if (total + shard->n_instances <= a_offset || a_out.size() >= a_limit) {
+            total += shard->n_instances;
+            continue;
+        }
+        for (const auto& view : shard->locations | std::views::values) {
+            const size_t n = view->rows.size();
+            if (total + n > a_offset && a_out.size() < a_limit) {
+                for (size_t i = a_offset > total ? a_offset - total : 0; i < n && a_out.size() < a_limit; ++i) {
+                    a_out.push_back(view->rows[i]);
+                }
             }
+            total += n;
         }
-    };
+    }
+    return total;
+}
 
-    // Iterate the smaller candidate set
-    if (haveStageSet && nStage <= nLoc) {
-        for (const FormID src_formid : stIt->second) {
-            if (!lit->second.contains(src_formid)) continue;
-            try_add_if_match(src_formid);
-        }
-        return out;
+std::shared_ptr<const std::vector<SourceSummary>> Manager::GetSourceSummaries() const {
+    if (auto summaries = GetReadModel()->summaries) {
+        return summaries;
     }
+    return std::make_shared<const std::vector<SourceSummary>>();
+}
+
+namespace {
+    // StageInstance as it was laid out with the editor ID stored inline; only used for the memory report
+    struct LegacyStageInstance {
+        float start_time;
+        StageNo no;
+        Count count;
+        Utils::Types::FormEditorID xtra;
+        bool is_fake;
+        bool is_decayed;
+        bool is_transforming;
+        bool crafting_allowed;
+        float _elapsed;
+        float _delay_start;
+        float _delay_mag;
+        FormID _delay_formid;
+    };
 
-    const auto stageSet = haveStageSet ? &stIt->second : nullptr;
+    size_t LegacyEditorIDHeapBytes(const std::string_view editorid) {
+        static const size_t sso_capacity = std::string().capacity();
+        if (editorid.size() <= sso_capacity) return 0;
+        return (editorid.size() | 15) + 1;
+    }
+}
 
-    for (const FormID src_formid : lit->second) {
-        if (stageSet && !stageSet->contains(src_formid)) continue;
-        try_add_if_match(src_formid);
+Manager::MemoryReport Manager::GetMemoryReport_() const {
+    MemoryReport report;
+    size_t legacy_heap = 0;
+    for (const auto& src : sources | std::views::values) {
+        DATA_SHARED_GUARD(*src);
+        for (const auto& instances : src->data | std::views::values) {
+            ++report.n_locations;
+            report.n_instances += instances.size();
+            for (const auto& inst : instances) {
+                legacy_heap += LegacyEditorIDHeapBytes(inst.xtra.GetEditorID());
+            }
+        }
+    }
+    report.bytes_per_instance = sizeof(StageInstance);
+    report.legacy_bytes_per_instance = sizeof(LegacyStageInstance);
+    if (report.n_instances) {
+        report.legacy_bytes_per_instance += legacy_heap / report.n_instances;
     }
+    const auto pool = Utils::Types::EditorIDPool::GetSingleton();
+    report.n_editor_ids = pool->Size();
+    report.editor_id_pool_bytes = pool->Bytes();
+    return report;
+}
 
-    return out;
+Manager::MemoryReport Manager::GetMemoryReport() {
+    SRC_SHARED_GUARD;
+    return GetMemoryReport_();
 }
 
 std::unordered_map<RefID, float> Manager::GetUpdateQueue() {
@@ -2200,7 +2944,9 @@ void Manager::HandleWOBaseChange(RE::TESObjectREFR* ref) {
         if (!st_inst || st_inst->count <= 0) return;
         if (const auto bound_expected = src->IsFakeStage(st_inst->no) ? src->GetBoundObject() : st_inst->GetBound();
             bound_expected->GetFormID() != bound->GetFormID()) {
+            const auto indexed = Source::IndexedStateOf(*st_inst);
             st_inst->count = 0;
+            src->ReindexSlot(a_refid, 0, indexed);
         }
     }
 }
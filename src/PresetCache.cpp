@@ -0,0 +1,324 @@
+#include "PresetCache.h"
+#include "PresetCodec.h"
+
+#ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+    #define NOMINMAX
+#endif
+#include <Windows.h>
+
+namespace {
+    constexpr std::uint32_t kMagic = 'AOTC';
+    // bump when the payload layout of AddOnSettings/DefaultSettings changes
+    constexpr std::uint32_t kFormatVersion = 1;
+
+    constexpr std::uint64_t kFnvOffset = 14695981039346656037ull;
+    constexpr std::uint64_t kFnvPrime = 1099511628211ull;
+
+    std::uint64_t Fnv1a(std::uint64_t hash, const void* data, const size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= kFnvPrime;
+        }
+        return hash;
+    }
+
+    std::uint64_t Fnv1a(const std::uint64_t hash, const std::string_view str) {
+        return Fnv1a(hash, str.data(), str.size());
+    }
+
+    template <class T>
+    std::uint64_t Fnv1aValue(const std::uint64_t hash, const T value) {
+        return Fnv1a(hash, &value, sizeof(T));
+    }
+
+    std::int64_t LastWriteTime(const std::filesystem::path& path) {
+        std::error_code ec;
+        const auto time = std::filesystem::last_write_time(path, ec);
+        return ec ? 0 : static_cast<std::int64_t>(time.time_since_epoch().count());
+    }
+}
+
+std::optional<PresetCache::SourceFile> PresetCache::ReadSource(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+    SourceFile source;
+    source.content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    source.stamp.size = source.content.size();
+    source.stamp.mtime = LastWriteTime(filename);
+    source.stamp.hash = Fnv1a(kFnvOffset, source.content);
+    return source;
+}
+
+PresetCache::PresetCache() : key_(ComputeKey()) {
+    Map_();
+    Index_();
+}
+
+PresetCache::~PresetCache() { Unmap_(); }
+
+std::uint64_t PresetCache::ComputeKey() {
+    auto key = Fnv1aValue(kFnvOffset, kFormatVersion);
+    key = Fnv1aValue(key, Utils::plugin_version.pack());
+
+    // FormIDs in the payloads are resolved against the current load order, and against the plugins' contents: an
+    // updated plugin keeps its name and slot but can move or drop the forms a preset names
+    if (const auto* data_handler = RE::TESDataHandler::GetSingleton()) {
+        for (const auto* file : data_handler->files) {
+            if (!file) continue;
+            const std::string_view filename = file->GetFilename();
+            key = Fnv1a(key, filename);
+            key = Fnv1aValue(key, file->GetCompileIndex());
+            key = Fnv1aValue(key, file->GetSmallFileCompileIndex());
+
+            const auto path = std::filesystem::path("Data") / filename;
+            std::error_code ec;
+            const auto size = std::filesystem::file_size(path, ec);
+            key = Fnv1aValue(key, ec ? std::uint64_t{0} : static_cast<std::uint64_t>(size));
+            key = Fnv1aValue(key, LastWriteTime(path));
+        }
+    }
+
+    // ...and against the form groups
+    const auto form_groups = std::format("Data/SKSE/Plugins/{}/formGroups", Utils::mod_name);
+    std::error_code ec;
+    std::vector<std::filesystem::path> group_files;
+    for (const auto& entry : std::filesystem::directory_iterator(form_groups, ec)) {
+        if (entry.is_regular_file()) group_files.push_back(entry.path());
+    }
+    std::ranges::sort(group_files);
+    for (const auto& path : group_files) {
+        const auto source = ReadSource(path.string());
+        if (!source) continue;
+        key = Fnv1a(key, path.string());
+        key = Fnv1aValue(key, source->stamp.hash);
+    }
+    return key;
+}
+
+void PresetCache::Map_() {
+    const auto path = std::filesystem::path(cache_path).wstring();
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return;
+    }
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return;
+    }
+    const auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return;
+    }
+    file_ = file;
+    mapping_ = mapping;
+    view_ = static_cast<const std::byte*>(view);
+    view_size_ = static_cast<size_t>(size.QuadPart);
+}
+
+void PresetCache::Unmap_() {
+    if (view_) UnmapViewOfFile(view_);
+    if (mapping_) CloseHandle(mapping_);
+    if (file_) CloseHandle(file_);
+    view_ = nullptr;
+    mapping_ = nullptr;
+    file_ = nullptr;
+    view_size_ = 0;
+}
+
+void PresetCache::Index_() {
+    if (!view_) {
+        logger::info("Preset cache not found, parsing all presets.");
+        return;
+    }
+
+    PresetCodec::Reader reader({view_, view_size_});
+    std::uint32_t magic = 0;
+    std::uint32_t version = 0;
+    std::uint64_t key = 0;
+    std::uint32_t n_entries = 0;
+    reader(magic);
+    reader(version);
+    reader(key);
+    reader(n_entries);
+    if (!reader.ok() || magic != kMagic || version != kFormatVersion) {
+        logger::warn("Preset cache has an unknown format, parsing all presets.");
+        return;
+    }
+    if (key != key_) {
+        logger::info("Load order, plugins or form groups changed, parsing all presets.");
+        return;
+    }
+
+    // entry: path, kind, size, mtime, hash, payload size, payload
+    size_t offset = sizeof(magic) + sizeof(version) + sizeof(key) + sizeof(n_entries);
+    for (std::uint32_t i = 0; i < n_entries; ++i) {
+        PresetCodec::Reader entry_reader({view_ + offset, view_size_ - offset});
+        std::string path;
+        std::uint8_t kind = 0;
+        MappedEntry entry{};
+        std::uint64_t payload_size = 0;
+        entry_reader(path);
+        entry_reader(kind);
+        entry_reader(entry.stamp.size);
+        entry_reader(entry.stamp.mtime);
+        entry_reader(entry.stamp.hash);
+        entry_reader(payload_size);
+        const size_t header_size = sizeof(std::uint32_t) + path.size() + sizeof(kind) + sizeof(entry.stamp.size) +
+                                   sizeof(entry.stamp.mtime) + sizeof(entry.stamp.hash) + sizeof(payload_size);
+        if (!entry_reader.ok() || view_size_ - offset - header_size < payload_size) {
+            logger::warn("Preset cache is truncated, parsing all presets.");
+            index_.clear();
+            return;
+        }
+        offset += header_size;
+        entry.kind = static_cast<Kind>(kind);
+        entry.payload = {view_ + offset, static_cast<size_t>(payload_size)};
+        offset += static_cast<size_t>(payload_size);
+        index_.emplace(std::move(path), entry);
+    }
+    logger::info("Preset cache has {} files.", index_.size());
+}
+
+std::optional<std::span<const std::byte>> PresetCache::Lookup_(const std::string& filename, const Kind kind,
+                                                               const FileStamp& stamp) {
+    const auto it = index_.find(filename);
+    if (it == index_.end()) return std::nullopt;
+    const auto& entry = it->second;
+    // mtime alone does not invalidate: touched files with the same bytes parse the same
+    if (entry.kind != kind || entry.stamp.size != stamp.size || entry.stamp.hash != stamp.hash) {
+        return std::nullopt;
+    }
+    std::lock_guard lock(mutex_);
+    kept_[filename] = stamp;
+    return entry.payload;
+}
+
+void PresetCache::Insert_(const std::string& filename, const Kind kind, const FileStamp& stamp,
+                          std::vector<std::byte> payload) {
+    std::lock_guard lock(mutex_);
+    kept_.erase(filename);
+    fresh_[filename] = {kind, stamp, std::move(payload)};
+}
+
+template <class T>
+bool PresetCache::Find_(const std::string& filename, const Kind kind, const FileStamp& stamp, T& a_out) {
+    const auto payload = Lookup_(filename, kind, stamp);
+    if (!payload) return false;
+    if (T settings; PresetCodec::Decode(*payload, settings)) {
+        a_out = std::move(settings);
+        return true;
+    }
+    logger::warn("Corrupt preset cache entry for {}", filename);
+    std::lock_guard lock(mutex_);
+    kept_.erase(filename);
+    return false;
+}
+
+bool PresetCache::Find(const std::string& filename, const FileStamp& stamp, DefaultSettings& a_out) {
+    if (!Find_(filename, Kind::kDefault, stamp, a_out)) return false;
+    // restores the health flag, which is not stored
+    if (!a_out.CheckIntegrity()) {
+        logger::warn("Cached settings integrity check failed for {}", filename);
+    }
+    return true;
+}
+
+bool PresetCache::Find(const std::string& filename, const FileStamp& stamp, CustomSettings& a_out) {
+    return Find_(filename, Kind::kCustom, stamp, a_out);
+}
+
+bool PresetCache::Find(const std::string& filename, const FileStamp& stamp, AddOnMap& a_out) {
+    return Find_(filename, Kind::kAddOn, stamp, a_out);
+}
+
+void PresetCache::Store(const std::string& filename, const FileStamp& stamp, const DefaultSettings& settings) {
+    Insert_(filename, Kind::kDefault, stamp, PresetCodec::Encode(settings));
+}
+
+void PresetCache::Store(const std::string& filename, const FileStamp& stamp, const CustomSettings& settings) {
+    Insert_(filename, Kind::kCustom, stamp, PresetCodec::Encode(settings));
+}
+
+void PresetCache::Store(const std::string& filename, const FileStamp& stamp, const AddOnMap& settings) {
+    Insert_(filename, Kind::kAddOn, stamp, PresetCodec::Encode(settings));
+}
+
+void PresetCache::Save() {
+    std::lock_guard lock(mutex_);
+
+    bool dirty = !fresh_.empty() || kept_.size() != index_.size();
+    for (const auto& [path, stamp] : kept_) {
+        if (dirty) break;
+        dirty = index_.at(path).stamp.mtime != stamp.mtime;
+    }
+    if (!dirty) {
+        logger::info("Preset cache is up to date ({} files).", kept_.size());
+        Unmap_();
+        return;
+    }
+
+    std::vector<std::byte> out;
+    PresetCodec::Writer writer(out);
+    writer(kMagic);
+    writer(kFormatVersion);
+    writer(key_);
+    writer(static_cast<std::uint32_t>(kept_.size() + fresh_.size()));
+
+    auto write_entry = [&](const std::string& path, const Kind kind, const FileStamp& stamp,
+                           const std::span<const std::byte> payload) {
+        writer(path);
+        writer(static_cast<std::uint8_t>(kind));
+        writer(stamp.size);
+        writer(stamp.mtime);
+        writer(stamp.hash);
+        writer(static_cast<std::uint64_t>(payload.size()));
+        out.insert(out.end(), payload.begin(), payload.end());
+    };
+    for (const auto& [path, stamp] : kept_) {
+        const auto& entry = index_.at(path);
+        write_entry(path, entry.kind, stamp, entry.payload);
+    }
+    for (const auto& [path, entry] : fresh_) {
+        write_entry(path, entry.kind, entry.stamp, entry.payload);
+    }
+
+    // the old file cannot be replaced while it is mapped
+    Unmap_();
+    index_.clear();
+
+    const auto tmp_path = cache_path + ".tmp";
+    {
+        std::ofstream ofs(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!ofs.is_open()) {
+            logger::error("Failed to write preset cache: {}", tmp_path);
+            return;
+        }
+        ofs.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()));
+        if (!ofs) {
+            logger::error("Failed to write preset cache: {}", tmp_path);
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, cache_path, ec);
+    if (ec) {
+        logger::error("Failed to replace preset cache: {}", ec.message());
+        return;
+    }
+    logger::info("Preset cache saved: {} reused, {} parsed.", kept_.size(), fresh_.size());
+}
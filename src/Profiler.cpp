@@ -0,0 +1,64 @@
+#include "Profiler.h"
+
+namespace {
+    // intrusive list; sites are function-local statics and never go away
+    std::atomic<Profiler::Site*> g_sites{nullptr};
+
+    Profiler::AllocationCounter g_allocation_counter = nullptr;
+}
+
+Profiler::Site::Site(const char* a_name) : name(a_name) {
+    next = g_sites.load(std::memory_order_relaxed);
+    while (!g_sites.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+}
+
+void Profiler::Site::Record(const uint64_t ns, const uint64_t n_allocs) {
+    calls.fetch_add(1, std::memory_order_relaxed);
+    total_ns.fetch_add(ns, std::memory_order_relaxed);
+    allocs.fetch_add(n_allocs, std::memory_order_relaxed);
+    uint64_t prev = max_ns.load(std::memory_order_relaxed);
+    while (ns > prev && !max_ns.compare_exchange_weak(prev, ns, std::memory_order_relaxed)) {
+    }
+}
+
+void Profiler::Site::Reset() {
+    calls.store(0, std::memory_order_relaxed);
+    total_ns.store(0, std::memory_order_relaxed);
+    max_ns.store(0, std::memory_order_relaxed);
+    allocs.store(0, std::memory_order_relaxed);
+}
+
+void Profiler::SetAllocationCounter(const AllocationCounter a_counter) {
+    g_allocation_counter = a_counter;
+}
+
+bool Profiler::CountsAllocations() {
+    return g_allocation_counter != nullptr;
+}
+
+uint64_t Profiler::ThreadAllocations() {
+    return g_allocation_counter ? g_allocation_counter() : 0;
+}
+
+std::vector<Profiler::Stats> Profiler::Snapshot() {
+    std::vector<Stats> out;
+    for (auto* site = g_sites.load(std::memory_order_acquire); site; site = site->next) {
+        const auto calls = site->calls.load(std::memory_order_relaxed);
+        if (!calls) continue;
+        const auto n = static_cast<double>(calls);
+        out.push_back({site->name, calls, static_cast<double>(site->total_ns.load(std::memory_order_relaxed)) / n,
+                       site->max_ns.load(std::memory_order_relaxed),
+                       static_cast<double>(site->allocs.load(std::memory_order_relaxed)) / n});
+    }
+    std::ranges::sort(out, [](const Stats& a, const Stats& b) {
+        return a.ns_per_op * static_cast<double>(a.calls) > b.ns_per_op * static_cast<double>(b.calls);
+    });
+    return out;
+}
+
+void Profiler::ResetAll() {
+    for (auto* site = g_sites.load(std::memory_order_acquire); site; site = site->next) {
+        site->Reset();
+    }
+}
@@ -3,19 +3,12 @@
 #include "Manager.h"
 
 void QueueManager::UpdateLoop() {
-    if (!ProcessPendingMoves(n_tasks_per_tick)) {
-        ProcessPendingProcess(n_tasks_per_tick);
-    }
+    ProcessPendingMoves(n_tasks_per_tick);
 }
 
 void QueueManager::UpdateLoopPlayer() {
 }
 
-std::size_t QueueManager::KeyHash::operator()(const Key& k) const noexcept {
-    const std::uint64_t packed = (static_cast<std::uint64_t>(k.first) << 32) | static_cast<std::uint64_t>(k.second);
-    return std::hash<std::uint64_t>{}(packed);
-}
-
 void QueueManager::ProcessAddItemTask(RE::TESObjectREFR* owner, const AddItemTask& task) {
     const auto item = RE::TESForm::LookupByID<RE::TESBoundObject>(task.item_id);
     if (!item) {
@@ -52,25 +45,85 @@ Count QueueManager::ProcessRemoveItemTask(RE::TESObjectREFR* owner, const Remove
     return count;
 }
 
-void QueueManager::ProcessPendingProcess(const int n_tasks) {
-    auto to_process = RequestPendingProcess(n_tasks);
+void QueueManager::ApplyTransfers(const std::vector<Transfer>& transfers) {
+    const auto lookup = [](const RefID refid) {
+        const auto ref = refid ? RE::TESForm::LookupByID<RE::TESObjectREFR>(refid) : nullptr;
+        return ref ? ref->GetHandle() : RE::ObjectRefHandle{};
+    };
+
+    std::vector<RefID> touched;
+    touched.reserve(transfers.size() * 2);
+
+    for (const auto& [from, to, what, count, from_refid] : transfers) {
+        const auto from_handle = lookup(from);
+        const auto to_handle = lookup(to);
+        const auto a_item = what ? RE::TESForm::LookupByID<RE::TESForm>(what) : nullptr;
+        M->UpdateImpl(from_handle.get().get(), to_handle.get().get(), a_item, count, from_refid, false);
+        if (from) touched.push_back(from);
+        if (to) touched.push_back(to);
+    }
+
+    // refresh every reference once instead of once per transfer
+    std::ranges::sort(touched);
+    const auto [first, last] = std::ranges::unique(touched);
+    touched.erase(first, last);
+    for (const auto refid : touched) {
+        if (const auto handle = lookup(refid)) {
+            M->UpdateImpl(handle.get().get(), nullptr, nullptr, 0, 0, true);
+        }
+    }
+}
 
-    if (to_process.empty()) {
+void QueueManager::QueueUpdate(RE::TESObjectREFR* from, RE::TESObjectREFR* to, const RE::TESForm* what,
+                               const Count count, const RefID from_refid) {
+    const Transfer transfer{from ? from->GetFormID() : 0, to ? to->GetFormID() : 0, what ? what->GetFormID() : 0,
+                            count, from_refid};
+    if (!transfer.from && !transfer.to) {
+        return;
+    }
+    // once something overflowed, later transfers queue behind it until the next drain
+    if (!overflowed_.load(std::memory_order_acquire) && transfer_ring_.TryPush(transfer)) {
         return;
     }
 
-    for (const auto& [key, transfers] : to_process) {
-        const auto from = key.first > 0 ? RE::TESForm::LookupByID<RE::TESObjectREFR>(key.first) : nullptr;
-        auto from_handle = from ? from->GetHandle() : RE::ObjectRefHandle{};
-        const auto to = key.second > 0 ? RE::TESForm::LookupByID<RE::TESObjectREFR>(key.second) : nullptr;
-        auto to_handle = to ? to->GetHandle() : RE::ObjectRefHandle{};
-        for (const auto& [what, count, from_refid] : transfers) {
-            const auto a_item = what > 0 ? RE::TESForm::LookupByID<RE::TESForm>(what) : nullptr;
-            M->UpdateImpl(from_handle.get().get(), to_handle.get().get(), a_item, count, from_refid, false);
-        }
-        M->UpdateImpl(from_handle.get().get(), nullptr, nullptr, 0, 0, true);
-        M->UpdateImpl(to_handle.get().get(), nullptr, nullptr, 0, 0, true);
+    std::lock_guard lock(overflow_mutex_);
+    overflow_.push_back(transfer);
+    overflowed_.store(true, std::memory_order_release);
+}
+
+void QueueManager::DrainUpdates() {
+    if (draining_.test_and_set(std::memory_order_acquire)) {
+        return;
+    }
+
+    Transfer transfer;
+    while (transfer_ring_.TryPop(transfer)) {
+        drained_.push_back(transfer);
+    }
+
+    size_t n_overflow = 0;
+    if (overflowed_.load(std::memory_order_acquire)) {
+        std::lock_guard lock(overflow_mutex_);
+        // recorded while the ring was full, so after everything it held
+        n_overflow = overflow_.size();
+        drained_.insert(drained_.end(), overflow_.begin(), overflow_.end());
+        overflow_.clear();
+        overflowed_.store(false, std::memory_order_release);
     }
+    // doubling intervals: a sustained burst logs a handful of lines, not one per frame
+    if (n_overflow && std::has_single_bit(++n_overflows_)) {
+        logger::warn("QueueUpdate: transfer ring ({}) overflowed {} times so far, last time by {} transfers",
+                     transfer_ring_size, n_overflows_, n_overflow);
+    }
+
+    // transfers recorded before a load refer to the previous session
+    if (!drained_.empty() && !M->isUninstalled.load() && !M->isLoading.load()) {
+        CoalesceTransfers(drained_);
+        ApplyTransfers(drained_);
+    }
+    drained_.clear();
+
+    draining_.clear(std::memory_order_release);
 }
 
 bool QueueManager::ProcessPendingMoves(const int n_tasks) {
@@ -258,20 +311,6 @@ void QueueManager::PruneAddRemoveItemTasks(
     }
 }
 
-//void QueueManager::QueueUpdate(const RE::TESObjectREFR* from, const RE::TESObjectREFR* to, const RE::TESForm* what,
-//                               const Count count, const RefID from_refid) {
-//    {
-//        auto from_id = from ? from->GetFormID() : 0;
-//        auto to_id = to ? to->GetFormID() : 0;
-//        const auto what_id = what ? what->GetFormID() : 0;
-//        if (from_id == 0 && to_id == 0) {
-//            return;
-//        }
-//        std::lock_guard lock(mutex_process_);
-//        pending_process[{from_id, to_id}].push_back(Transfer{what_id, count, from_refid});
-//    }
-//}
-
 void QueueManager::QueueAddRemoveItemTask(const AddItemTask& add_task, const RemoveItemTask& remove_task) {
     {
         const auto add_id = add_task.to;
@@ -294,42 +333,6 @@ void QueueManager::QueueAddRemoveItemTask(const AddItemTask& add_task, const Rem
 }
 
 
-QueueManager::PendingMap QueueManager::RequestPendingProcess(int n_pending) {
-    PendingMap result;
-    if (n_pending <= 0) {
-        return result;
-    }
-
-    {
-        std::lock_guard lock(mutex_process_);
-        for (auto it = pending_process.begin(); it != pending_process.end() && n_pending > 0;) {
-            auto& q = it->second;
-
-            if (q.empty()) {
-                it = pending_process.erase(it);
-                continue;
-            }
-
-            auto& out = result[it->first];
-
-            while (!q.empty() && n_pending > 0) {
-                out.push_back(std::move(q.front()));
-                q.pop_front();
-                --n_pending;
-            }
-
-            if (q.empty()) {
-                it = pending_process.erase(it);
-            } else {
-                ++it;
-            }
-        }
-    }
-
-    return result;
-}
-
-
 std::unordered_map<RefID, std::vector<AddRemoveItemTask>> QueueManager::RequestPendingMoveItem(int n_pending) {
     std::unordered_map<RefID, std::vector<AddRemoveItemTask>> result;
     if (n_pending <= 0) return result;
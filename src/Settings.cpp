@@ -5,6 +5,8 @@
 #include "CLibUtilsQTR/PresetHelpers/PresetHelpersYAML.hpp"
 #include "CLibUtilsQTR/StringHelpers.hpp"
 #include "Lorebox.h"
+#include "PresetCache.h"
+#include "WordMatcher.h"
 #include "rapidjson/stringbuffer.h"
 #include <rapidjson/istreamwrapper.h>
 #include <rapidjson/writer.h>
@@ -13,26 +15,186 @@ using QFormChecker = bool(*)(const RE::TESForm*);
 
 namespace {
     std::shared_mutex g_settingsCacheMtx;
-    std::unordered_map<FormID, std::string> g_qformCache;
     std::unordered_map<FormID, bool> g_excludeCache;
     std::unordered_map<FormID, DefaultSettings*> g_customCache; // nullptr cached too
     std::unordered_map<FormID, AddOnSettings*> g_addonCache; // nullptr cached too
+
+    // custom_settings of one QFORM type compiled for lookup. Index i is the i-th healthy entry in map order;
+    // the smallest index that matches wins, like the linear scan over the map did.
+    struct CustomMatcher {
+        std::vector<DefaultSettings*> entries;
+        // first entry naming the form by FormID/EditorID
+        std::unordered_map<FormID, uint32_t> by_formid;
+        // all names of all entries, matched against the form name
+        WordMatcher names;
+    };
+
+    // written only by LoadSettingsParallel, like custom_settings
+    std::unordered_map<std::string, CustomMatcher> g_customMatchers;
+
+    void BuildCustomMatchers() {
+        g_customMatchers.clear();
+        for (auto& [qform_type, customs] : Settings::custom_settings) {
+            auto& matcher = g_customMatchers[qform_type];
+            for (auto& [names, sttng] : customs) {
+                if (!sttng.IsHealthy()) continue;
+                const auto index = static_cast<uint32_t>(matcher.entries.size());
+                matcher.entries.push_back(&sttng);
+                for (const auto& name : names) {
+                    if (const FormID temp = FormReader::GetFormEditorIDFromString(name); temp > 0) {
+                        if (const auto tempForm = FormReader::GetFormByID(temp, name)) {
+                            matcher.by_formid.try_emplace(tempForm->GetFormID(), index);
+                        }
+                    }
+                    matcher.names.Add(name, index);
+                }
+            }
+            matcher.names.Build();
+            logger::info("Compiled {} custom settings for {}: {} forms, {} name states", matcher.entries.size(),
+                         qform_type, matcher.by_formid.size(), matcher.names.StateCount());
+        }
+    }
+
+    // exclude_list of each QFORM type compiled into one matcher. A handful of types, so a flat list searched by
+    // string_view instead of a map keyed by std::string.
+    std::shared_mutex g_excludeMatchersMtx;
+    std::vector<std::pair<std::string, WordMatcher>> g_excludeMatchers;
+
+    void BuildExcludeMatcher(const std::string& qform_type, const std::vector<std::string>& words) {
+        WordMatcher matcher;
+        for (const auto& word : words) matcher.Add(word, 0);
+        matcher.Build();
+
+        std::unique_lock lk(g_excludeMatchersMtx);
+        const auto it = std::ranges::find(g_excludeMatchers, qform_type, &std::pair<std::string, WordMatcher>::first);
+        if (it != g_excludeMatchers.end()) it->second = std::move(matcher);
+        else g_excludeMatchers.emplace_back(qform_type, std::move(matcher));
+    }
+
+    // nullopt if the type has no exclude list
+    std::optional<bool> MatchExclude(const std::string_view qformtype, const std::string_view editorid,
+                                     const std::string_view name) {
+        std::shared_lock lk(g_excludeMatchersMtx);
+        const auto it = std::ranges::find_if(g_excludeMatchers, [qformtype](const auto& entry) {
+            return entry.first == qformtype;
+        });
+        if (it == g_excludeMatchers.end()) return std::nullopt;
+        const auto& matcher = it->second;
+        if (!editorid.empty() && matcher.Matches(editorid)) return true;
+        return !name.empty() && matcher.Matches(name);
+    }
+
+    DefaultSettings* MatchCustomSetting(const RE::TESForm* form, const std::string_view qformtype) {
+        const auto it = g_customMatchers.find(std::string(qformtype));
+        if (it == g_customMatchers.end()) return nullptr;
+        const auto& matcher = it->second;
+
+        uint32_t best = WordMatcher::no_match;
+        if (const auto f = matcher.by_formid.find(form->GetFormID()); f != matcher.by_formid.end()) {
+            best = f->second;
+        }
+        if (const char* name = form->GetName()) {
+            best = std::min(best, matcher.names.FirstMatch(name));
+        }
+        return best == WordMatcher::no_match ? nullptr : matcher.entries[best];
+    }
 }
 
-static const std::unordered_map<std::string, QFormChecker> qformCheckers = {
-    // POPULATE THIS
-    {"FOOD", [](const auto form) { return Utils::IsFoodItem(form); }},
-    {"INGR", [](const auto form) { return form->Is(RE::IngredientItem::FORMTYPE); }},
-    {"MEDC", [](const auto form) { return Utils::IsMedicineItem(form); }},
-    {"POSN", [](const auto form) { return Utils::IsPoisonItem(form); }},
-    {"ARMO", [](const auto form) { return form->Is(RE::TESObjectARMO::FORMTYPE); }},
-    {"WEAP", [](const auto form) { return form->Is(RE::TESObjectWEAP::FORMTYPE); }},
-    {"SCRL", [](const auto form) { return form->Is(RE::ScrollItem::FORMTYPE); }},
-    {"BOOK", [](const auto form) { return form->Is(RE::TESObjectBOOK::FORMTYPE); }},
-    {"SLGM", [](const auto form) { return form->Is(RE::TESSoulGem::FORMTYPE); }},
-    {"MISC", [](const auto form) { return form->Is(RE::TESObjectMISC::FORMTYPE); }},
-    //{"NPC", [](const auto form) {return FormIsOfType(form, RE::TESNPC::FORMTYPE); } }
-};
+namespace {
+    using Settings::QForm;
+
+    struct QFormRule {
+        QFormChecker check;
+        // the form types check can accept; None pads
+        std::array<RE::FormType, 2> form_types;
+    };
+
+    // indexed by QForm
+    const std::array<QFormRule, Settings::n_qforms> qformRules = {{
+        // POPULATE THIS
+        {[](const auto form) { return Utils::IsFoodItem(form); },
+         {RE::AlchemyItem::FORMTYPE, RE::IngredientItem::FORMTYPE}},
+        {[](const auto form) { return form->Is(RE::IngredientItem::FORMTYPE); }, {RE::IngredientItem::FORMTYPE}},
+        {[](const auto form) { return Utils::IsMedicineItem(form); }, {RE::AlchemyItem::FORMTYPE}},
+        {[](const auto form) { return Utils::IsPoisonItem(form); }, {RE::AlchemyItem::FORMTYPE}},
+        {[](const auto form) { return form->Is(RE::TESObjectARMO::FORMTYPE); }, {RE::TESObjectARMO::FORMTYPE}},
+        {[](const auto form) { return form->Is(RE::TESObjectWEAP::FORMTYPE); }, {RE::TESObjectWEAP::FORMTYPE}},
+        {[](const auto form) { return form->Is(RE::ScrollItem::FORMTYPE); }, {RE::ScrollItem::FORMTYPE}},
+        {[](const auto form) { return form->Is(RE::TESObjectBOOK::FORMTYPE); }, {RE::TESObjectBOOK::FORMTYPE}},
+        {[](const auto form) { return form->Is(RE::TESSoulGem::FORMTYPE); }, {RE::TESSoulGem::FORMTYPE}},
+        {[](const auto form) { return form->Is(RE::TESObjectMISC::FORMTYPE); }, {RE::TESObjectMISC::FORMTYPE}},
+        //{"NPC", [](const auto form) {return FormIsOfType(form, RE::TESNPC::FORMTYPE); } }
+    }};
+
+    // Enabled QForms that may apply to each form type, in QFORMS order; the first whose check passes wins.
+    // At most FOOD/MEDC/POSN share a form type (AlchemyItem), so three slots are enough.
+    struct QFormCandidates {
+        std::array<QForm, 3> qforms{};
+        uint8_t count = 0;
+    };
+
+    // written only by LoadSettingsParallel, like QFORMS
+    std::array<QFormCandidates, 256> g_qformTable{};
+
+    void BuildQFormTable() {
+        g_qformTable = {};
+        for (const auto& name : Settings::QFORMS) {
+            const auto qform = Settings::QFormFromName(name);
+            if (qform == QForm::kNone) continue;
+            for (const auto form_type : qformRules[std::to_underlying(qform)].form_types) {
+                if (form_type == RE::FormType::None) continue;
+                auto& candidates = g_qformTable[std::to_underlying(form_type)];
+                if (candidates.count < candidates.qforms.size()) {
+                    candidates.qforms[candidates.count++] = qform;
+                }
+            }
+        }
+    }
+
+    struct Resolution {
+        QForm qform;
+        bool excluded;
+        DefaultSettings* custom;
+        AddOnSettings* addon;
+    };
+
+    // Settings resolved for every bound form of the enabled modules by PrewarmResolutions. Sorted by FormID and
+    // never modified once published, so lookups take no lock. Forms it does not cover (created later, or not
+    // QForms) fall back to the lazy caches.
+    struct ResolutionSnapshot {
+        std::vector<FormID> ids;
+        std::vector<Resolution> resolutions;
+        // excluded flags are only valid while no entry was added to an exclude list since the build
+        uint32_t exclude_generation = 0;
+
+        [[nodiscard]] const Resolution* Find(const FormID formid) const {
+            const auto it = std::ranges::lower_bound(ids, formid);
+            if (it == ids.end() || *it != formid) return nullptr;
+            return &resolutions[it - ids.begin()];
+        }
+    };
+
+    std::atomic<const ResolutionSnapshot*> g_snapshot{nullptr};
+    // owns every published snapshot; readers may still hold an old one, so they are only freed at exit
+    std::vector<std::unique_ptr<ResolutionSnapshot>> g_snapshots;
+    std::atomic<uint32_t> g_excludeGeneration{0};
+
+    const Resolution* FindResolution(const FormID formid) {
+        const auto* snapshot = g_snapshot.load(std::memory_order_acquire);
+        return snapshot ? snapshot->Find(formid) : nullptr;
+    }
+
+    // nullopt unless the snapshot has a current answer for formid under type (empty: the form's own type)
+    std::optional<bool> FindExcluded(const FormID formid, const std::string_view type) {
+        const auto* snapshot = g_snapshot.load(std::memory_order_acquire);
+        if (!snapshot || snapshot->exclude_generation != g_excludeGeneration.load(std::memory_order_acquire)) {
+            return std::nullopt;
+        }
+        const auto* resolution = snapshot->Find(formid);
+        if (!resolution || (!type.empty() && type != Settings::QFormName(resolution->qform))) return std::nullopt;
+        return resolution->excluded;
+    }
+}
 
 void Settings::SetCurrentTickInterval(const Ticker::Intervals interval) {
     ticker_speed = interval;
@@ -40,43 +202,44 @@ void Settings::SetCurrentTickInterval(const Ticker::Intervals interval) {
 
 bool Settings::IsQFormType(const RE::TESForm* form, const std::string_view qformtype) {
     if (!form || qformtype.empty()) return false;
-    const auto it = qformCheckers.find(std::string(qformtype));
-    return (it != qformCheckers.end()) ? it->second(form) : false;
+    const auto qform = QFormFromName(qformtype);
+    return qform != QForm::kNone && qformRules[std::to_underlying(qform)].check(form);
 }
 
-std::string_view Settings::GetQFormType(const RE::TESForm* form) {
-    if (!form) return {};
+Settings::QForm Settings::GetQForm(const RE::TESForm* form) {
+    if (!form) return QForm::kNone;
 
-    for (const auto& q_ftype : QFORMS) {
-        auto it = qformCheckers.find(q_ftype);
-        if (it != qformCheckers.end() && it->second(form)) {
-            return q_ftype; // view to string stored in QFORMS
+    const auto& candidates = g_qformTable[std::to_underlying(form->GetFormType())];
+    for (uint8_t i = 0; i < candidates.count; ++i) {
+        if (const auto qform = candidates.qforms[i]; qformRules[std::to_underlying(qform)].check(form)) {
+            return qform;
         }
     }
-    return {};
+    return QForm::kNone;
+}
+
+std::string_view Settings::GetQFormType(const RE::TESForm* form) {
+    return QFormName(GetQForm(form));
 }
 
 bool Settings::IsInExclude(const RE::TESForm* form, std::string_view type) {
     if (!form) return false;
+    if (const auto excluded = FindExcluded(form->GetFormID(), type)) return *excluded;
 
     if (type.empty()) {
         type = GetQFormType(form);
         if (type.empty()) return false;
     }
 
-    const auto exIt = exclude_list.find(std::string(type));
-    if (exIt == exclude_list.end()) {
+    const std::string_view name = form->GetName() ? std::string_view(form->GetName()) : std::string_view{};
+    const std::string editorid = clib_util::editorID::get_editorID(form);
+
+    const auto excluded = MatchExclude(type, editorid, name);
+    if (!excluded) {
         logger::critical("Type not found in exclude list. formid: {}", form->GetFormID());
         return false;
     }
-
-    const auto& words = exIt->second;
-    const std::string name = form->GetName() ? form->GetName() : "";
-    const std::string editorid = clib_util::editorID::get_editorID(form);
-
-    if (!editorid.empty() && StringHelpers::includesWord(editorid, words)) return true;
-    if (StringHelpers::includesWord(name, words)) return true;
-    return false;
+    return *excluded;
 }
 
 DefaultSettings* Settings::GetDefaultSetting(const std::string_view qformtype) {
@@ -104,29 +267,14 @@ AddOnSettings* Settings::GetAddOnSettings(const FormID form_id, const std::strin
 
 DefaultSettings* Settings::GetCustomSetting(const RE::TESForm* form, std::string_view qformtype) {
     if (!form) return nullptr;
+    if (const auto* resolution = FindResolution(form->GetFormID());
+        resolution && (qformtype.empty() || qformtype == QFormName(resolution->qform))) {
+        return resolution->custom;
+    }
     if (qformtype.empty()) qformtype = GetQFormType(form);
     if (qformtype.empty()) return nullptr;
 
-    const auto itType = custom_settings.find(std::string(qformtype));
-    if (itType == custom_settings.end()) return nullptr;
-
-    const FormID form_id = form->GetFormID();
-
-    for (auto& [names, sttng] : itType->second) {
-        if (!sttng.IsHealthy()) continue;
-
-        for (auto& name : names) {
-            if (const FormID temp = FormReader::GetFormEditorIDFromString(name); temp > 0) {
-                if (const auto tempForm = FormReader::GetFormByID(temp, name);
-                    tempForm && tempForm->GetFormID() == form_id) {
-                    return &sttng;
-                }
-            }
-        }
-        if (StringHelpers::includesWord(form->GetName(), names)) return &sttng;
-    }
-
-    return nullptr;
+    return MatchCustomSetting(form, qformtype);
 }
 
 
@@ -141,33 +289,15 @@ bool Settings::IsQFormType(const FormID formid, const std::string& qformtype) {
 
 std::string Settings::GetQFormType(const FormID formid) {
     if (!formid) return "";
-
-    {
-        std::shared_lock lk(g_settingsCacheMtx);
-        if (const auto it = g_qformCache.find(formid); it != g_qformCache.end()) {
-            return it->second;
-        }
-    }
+    if (const auto* resolution = FindResolution(formid)) return std::string(QFormName(resolution->qform));
 
     const auto* form = FormReader::GetFormByID(formid);
     if (!form) {
-        logger::warn("GetQFormType: Form {:x} not found.", formid);
-        std::unique_lock lk(g_settingsCacheMtx);
-        g_qformCache.emplace(formid, "");
+        // no longer cached per formid, so keep a missing form out of the warning log
+        logger::trace("GetQFormType: Form {:x} not found.", formid);
         return "";
     }
-
-    std::string result;
-    for (const auto& q_ftype : QFORMS) {
-        if (IsQFormType(form, q_ftype)) {
-            result = q_ftype;
-            break;
-        }
-    }
-
-    std::unique_lock lk(g_settingsCacheMtx);
-    g_qformCache.emplace(formid, result);
-    return result;
+    return std::string(GetQFormType(form));
 }
 
 
@@ -181,6 +311,7 @@ bool Settings::IsSpecialQForm(RE::TESObjectREFR* ref) {
 
 bool Settings::IsInExclude(const FormID formid, std::string type) {
     if (!formid) return false;
+    if (const auto excluded = FindExcluded(formid, type)) return *excluded;
 
     if (type.empty()) type = GetQFormType(formid);
     if (type.empty()) return false;
@@ -198,21 +329,15 @@ bool Settings::IsInExclude(const FormID formid, std::string type) {
         return false;
     }
 
-    if (!exclude_list.contains(type)) {
-        logger::critical("Type not found in exclude list. for formid: {:x}", formid);
-        return false;
-    }
-
     const std::string form_editorid = clib_util::editorID::get_editorID(form);
     const std::string_view form_name = form->GetName() ? std::string_view(form->GetName()) : std::string_view{};
 
-    bool excluded = false;
-
-    if (!form_editorid.empty() && StringHelpers::includesWord(form_editorid, exclude_list[type])) {
-        excluded = true;
-    } else if (!form_name.empty() && StringHelpers::includesWord(std::string(form_name), exclude_list[type])) {
-        excluded = true;
+    const auto match = MatchExclude(type, form_editorid, form_name);
+    if (!match) {
+        logger::critical("Type not found in exclude list. for formid: {:x}", formid);
+        return false;
     }
+    const bool excluded = *match;
 
     {
         std::unique_lock lk(g_settingsCacheMtx);
@@ -244,6 +369,12 @@ void Settings::AddToExclude(const std::string& entry_name, const std::string& ty
     file << entry_name << '\n';
     file.close();
     exclude_list[type].push_back(entry_name);
+    BuildExcludeMatcher(type, exclude_list[type]);
+    g_excludeGeneration.fetch_add(1, std::memory_order_acq_rel);
+    {
+        std::unique_lock lk(g_settingsCacheMtx);
+        g_excludeCache.clear();
+    }
 }
 
 bool Settings::IsItem(const FormID formid, const std::string& type, const bool check_exclude) {
@@ -279,6 +410,8 @@ DefaultSettings* Settings::GetCustomSetting(const RE::TESForm* form) {
     if (!form) return nullptr;
     const FormID form_id = form->GetFormID();
 
+    if (const auto* resolution = FindResolution(form_id)) return resolution->custom;
+
     {
         std::shared_lock lk(g_settingsCacheMtx);
         if (const auto it = g_customCache.find(form_id); it != g_customCache.end()) {
@@ -288,27 +421,8 @@ DefaultSettings* Settings::GetCustomSetting(const RE::TESForm* form) {
 
     DefaultSettings* result = nullptr;
 
-    const auto qform_type = GetQFormType(form_id);
-    if (!qform_type.empty() && custom_settings.contains(qform_type)) {
-        for (auto& customSetting = custom_settings[qform_type]; auto& [names, sttng] : customSetting) {
-            if (!sttng.IsHealthy()) continue;
-
-            for (auto& name : names) {
-                if (const FormID temp_cstm_formid = FormReader::GetFormEditorIDFromString(name); temp_cstm_formid > 0) {
-                    if (const auto temp_cstm_form = FormReader::GetFormByID(temp_cstm_formid, name);
-                        temp_cstm_form && temp_cstm_form->GetFormID() == form_id) {
-                        result = &sttng;
-                        break;
-                    }
-                }
-            }
-            if (result) break;
-
-            if (StringHelpers::includesWord(form->GetName(), names)) {
-                result = &sttng;
-                break;
-            }
-        }
+    if (const auto qform_type = GetQFormType(form_id); !qform_type.empty()) {
+        result = MatchCustomSetting(form, qform_type);
     }
 
     {
@@ -323,6 +437,8 @@ AddOnSettings* Settings::GetAddOnSettings(const RE::TESForm* form) {
     if (!form) return nullptr;
     const FormID form_id = form->GetFormID();
 
+    if (const auto* resolution = FindResolution(form_id)) return resolution->addon;
+
     {
         std::shared_lock lk(g_settingsCacheMtx);
         if (const auto it = g_addonCache.find(form_id); it != g_addonCache.end()) {
@@ -365,6 +481,7 @@ void PresetParse::SaveSettings() {
     doc.AddMember("max_dirty_updates",
                   static_cast<uint32_t>(Settings::max_dirty_updates.load()),
                   allocator);
+    doc.AddMember("dirty_update_budget_us", Settings::dirty_update_budget_us.load(), allocator);
 
     // Convert JSON document to string
     StringBuffer buffer;
@@ -414,7 +531,7 @@ namespace {
         }
     }
 
-    void processCustomFile(const std::string& filename, CustomSettings& combinedSettings) {
+    void processCustomFile(const std::string& filename, CustomSettings& combinedSettings, PresetCache& cache) {
         logger::info("Parsing file: {}", filename);
         // Create a temporary result for this file
         CustomSettings fileResult;
@@ -423,24 +540,33 @@ namespace {
             return;
         }
 
-        YAML::Node config = YAML::LoadFile(filename);
-
-        if (!config["ownerLists"]) {
-            logger::warn("OwnerLists not found in {}", filename);
+        const auto source = PresetCache::ReadSource(filename);
+        if (!source) {
+            logger::warn("Failed to open {}", filename);
             return;
         }
 
-        for (const auto& Node_ : config["ownerLists"]) {
-            if (!Node_["owners"]) {
-                logger::warn("Owners not found in {}", filename);
+        if (!cache.Find(filename, source->stamp, fileResult)) {
+            YAML::Node config = YAML::Load(source->content);
+
+            if (!config["ownerLists"]) {
+                logger::warn("OwnerLists not found in {}", filename);
                 return;
             }
-            // we have list of owners at each node or a scalar owner
-            if (auto temp_settings = PresetParse::parseDefaults_(Node_); temp_settings.CheckIntegrity()) {
-                std::vector<std::string> owners = PresetHelpers::YAML_Helpers::CollectFrom<
-                    std::string>(Node_, "owners");
-                fileResult[owners] = temp_settings;
+
+            for (const auto& Node_ : config["ownerLists"]) {
+                if (!Node_["owners"]) {
+                    logger::warn("Owners not found in {}", filename);
+                    return;
+                }
+                // we have list of owners at each node or a scalar owner
+                if (auto temp_settings = PresetParse::parseDefaults_(Node_); temp_settings.CheckIntegrity()) {
+                    std::vector<std::string> owners = PresetHelpers::YAML_Helpers::CollectFrom<
+                        std::string>(Node_, "owners");
+                    fileResult[owners] = temp_settings;
+                }
             }
+            cache.Store(filename, source->stamp, fileResult);
         }
 
         if (!fileResult.empty()) {
@@ -449,7 +575,7 @@ namespace {
         }
     }
 
-    CustomSettings parseCustomsParallel(const std::string& _type) {
+    CustomSettings parseCustomsParallel(const std::string& _type, PresetCache& cache) {
         CustomSettings combinedSettings;
         const auto folder_path = "Data/SKSE/Plugins/AlchemyOfTime/" + _type + "/custom";
         std::filesystem::create_directories(folder_path);
@@ -462,26 +588,16 @@ namespace {
             }
         }
 
-        // Reserve space for futures
-        std::vector<std::future<void>> futures;
-        futures.reserve(filenames.size());
-
-        // Create a thread pool with available hardware threads
-        ThreadPool pool(numThreads);
-
-        // Enqueue a task for each file. Each task will parse and merge its file.
+        // One task per file on the shared scheduler. Each task will parse and merge its file.
+        TaskGroup group;
         for (const auto& filename : filenames) {
-            futures.emplace_back(
-                pool.enqueue([filename, &combinedSettings]() {
-                    processCustomFile(filename, combinedSettings);
-                })
-                );
+            group.Run([filename, &combinedSettings, &cache]() {
+                processCustomFile(filename, combinedSettings, cache);
+            });
         }
 
-        // Wait for all tasks to complete
-        for (auto& fut : futures) {
-            fut.get();
-        }
+        // Wait for all tasks to complete (helps run them when called from a scheduler task)
+        group.Wait();
 
         // Return the fully merged settings after all threads are done
         return combinedSettings;
@@ -494,7 +610,8 @@ namespace {
         }
     }
 
-    void processAddOnFile(const std::string& filename, std::unordered_map<FormID, AddOnSettings>& combinedSettings) {
+    void processAddOnFile(const std::string& filename, std::unordered_map<FormID, AddOnSettings>& combinedSettings,
+                          PresetCache& cache) {
         logger::info("Parsing file: {}", filename);
 
         std::unordered_map<FormID, AddOnSettings> fileResult;
@@ -504,33 +621,43 @@ namespace {
             return;
         }
 
-        YAML::Node config = YAML::LoadFile(filename);
-
-        if (!config["formsLists"] || config["formsLists"].IsNull()) {
-            logger::warn("formsLists not found in {}", filename);
-            return;
-        }
-        if (config["formsLists"].size() == 0) {
-            logger::warn("formsLists is empty in {}", filename);
+        const auto source = PresetCache::ReadSource(filename);
+        if (!source) {
+            logger::warn("Failed to open {}", filename);
             return;
         }
 
-        for (const auto& Node_ : config["formsLists"]) {
-            if (!Node_["forms"] || Node_["forms"].IsNull()) {
-                logger::warn("Forms not found in {}", filename);
+        if (!cache.Find(filename, source->stamp, fileResult)) {
+            YAML::Node config = YAML::Load(source->content);
+
+            if (!config["formsLists"] || config["formsLists"].IsNull()) {
+                logger::warn("formsLists not found in {}", filename);
                 return;
             }
-            // we have list of owners at each node or a scalar owner
-            if (auto temp_settings = PresetParse::parseAddOns_(Node_); temp_settings.CheckIntegrity()) {
-                for (const auto owner : PresetHelpers::YAML_Helpers::CollectFrom<FormID, std::string>(Node_, "forms")) {
-                    fileResult[owner] = temp_settings;
+            if (config["formsLists"].size() == 0) {
+                logger::warn("formsLists is empty in {}", filename);
+                return;
+            }
+
+            for (const auto& Node_ : config["formsLists"]) {
+                if (!Node_["forms"] || Node_["forms"].IsNull()) {
+                    logger::warn("Forms not found in {}", filename);
+                    return;
+                }
+                // we have list of owners at each node or a scalar owner
+                if (auto temp_settings = PresetParse::parseAddOns_(Node_); temp_settings.CheckIntegrity()) {
+                    for (const auto owner : PresetHelpers::YAML_Helpers::CollectFrom<
+                             FormID, std::string>(Node_, "forms")) {
+                        fileResult[owner] = temp_settings;
+                    }
+                } else {
+                    logger::error("Settings integrity check failed for forms starting with {}",
+                                  Node_["forms"].IsScalar()
+                                      ? Node_["forms"].as<std::string>()
+                                      : Node_["forms"].begin()->as<std::string>());
                 }
-            } else {
-                logger::error("Settings integrity check failed for forms starting with {}",
-                              Node_["forms"].IsScalar()
-                                  ? Node_["forms"].as<std::string>()
-                                  : Node_["forms"].begin()->as<std::string>());
             }
+            cache.Store(filename, source->stamp, fileResult);
         }
 
         if (!fileResult.empty()) {
@@ -539,7 +666,7 @@ namespace {
         }
     }
 
-    std::unordered_map<FormID, AddOnSettings> parseAddOnsParallel(const std::string& _type) {
+    std::unordered_map<FormID, AddOnSettings> parseAddOnsParallel(const std::string& _type, PresetCache& cache) {
         std::unordered_map<FormID, AddOnSettings> combinedSettings;
         const auto folder_path = "Data/SKSE/Plugins/AlchemyOfTime/" + _type + "/addon";
         std::filesystem::create_directories(folder_path);
@@ -550,20 +677,14 @@ namespace {
                 filenames.push_back(entry.path().string());
             }
         }
-        std::vector<std::future<void>> futures;
-        futures.reserve(filenames.size());
-        ThreadPool pool(numThreads);
+        TaskGroup group;
         for (const auto& filename : filenames) {
-            futures.emplace_back(
-                pool.enqueue([filename, &combinedSettings]() {
-                    processAddOnFile(filename, combinedSettings);
-                })
-                );
+            group.Run([filename, &combinedSettings, &cache]() {
+                processAddOnFile(filename, combinedSettings, cache);
+            });
         }
         // Wait for all tasks to complete
-        for (auto& fut : futures) {
-            fut.get();
-        }
+        group.Wait();
         return combinedSettings;
     }
 
@@ -882,7 +1003,7 @@ DefaultSettings PresetParse::parseDefaults_(const YAML::Node& config) {
     return settings;
 }
 
-DefaultSettings PresetParse::parseDefaults(const std::string& _type) {
+DefaultSettings PresetParse::parseDefaults(const std::string& _type, PresetCache* cache) {
     const auto filename = "Data/SKSE/Plugins/AlchemyOfTime/" + _type + "/AoT_default" + _type + ".yml";
 
     // check if the file exists
@@ -897,11 +1018,30 @@ DefaultSettings PresetParse::parseDefaults(const std::string& _type) {
     }
 
     logger::info("Filename: {}", filename);
-    const YAML::Node config = YAML::LoadFile(filename);
-    auto temp_settings = parseDefaults_(config);
+    if (!cache) {
+        const YAML::Node config = YAML::LoadFile(filename);
+        auto temp_settings = parseDefaults_(config);
+        if (!temp_settings.CheckIntegrity()) {
+            logger::warn("parseDefaults: Settings integrity check failed for {}", _type);
+        }
+        return temp_settings;
+    }
+
+    const auto source = PresetCache::ReadSource(filename);
+    if (!source) {
+        logger::warn("Failed to open {}", filename);
+        return {};
+    }
+    DefaultSettings temp_settings;
+    if (cache->Find(filename, source->stamp, temp_settings)) {
+        return temp_settings;
+    }
+    const YAML::Node config = YAML::Load(source->content);
+    temp_settings = parseDefaults_(config);
     if (!temp_settings.CheckIntegrity()) {
         logger::warn("parseDefaults: Settings integrity check failed for {}", _type);
     }
+    cache->Store(filename, source->stamp, temp_settings);
     return temp_settings;
 }
 
@@ -953,6 +1093,29 @@ void PresetParse::LoadINISettings() {
                                                        Settings::placed_objects_evolve);
     Settings::unowned_objects_evolve = ini.GetBoolValue("Other Settings", "UnOwnedObjectsEvolve",
                                                         Settings::unowned_objects_evolve);
+    // not written back on purpose: debugging switch for comparing against the old catch-up loop
+    Settings::stepwise_catch_up = ini.GetBoolValue("Other Settings", "StepwiseCatchUp",
+                                                   Settings::stepwise_catch_up);
+    Settings::prewarm_settings = ini.GetBoolValue("Other Settings", "PrewarmSettings", Settings::prewarm_settings);
+    ini.SetBoolValue("Other Settings", "PrewarmSettings", Settings::prewarm_settings);
+
+    Settings::lod_near_distance = std::max(0.f, static_cast<float>(ini.GetDoubleValue(
+                                                 "Other Settings", "LodNearDistance", Settings::lod_near_distance)));
+    Settings::lod_far_distance = std::max(Settings::lod_near_distance,
+                                          static_cast<float>(ini.GetDoubleValue(
+                                              "Other Settings", "LodFarDistance", Settings::lod_far_distance)));
+    Settings::lod_mid_step = std::max(0.f, static_cast<float>(ini.GetDoubleValue(
+                                            "Other Settings", "LodMidStepHours", Settings::lod_mid_step)));
+    Settings::lod_far_step = std::max(0.f, static_cast<float>(ini.GetDoubleValue(
+                                            "Other Settings", "LodFarStepHours", Settings::lod_far_step)));
+    Settings::lod_retier_distance = std::max(0.f, static_cast<float>(ini.GetDoubleValue(
+                                                   "Other Settings", "LodRetierDistance",
+                                                   Settings::lod_retier_distance)));
+    ini.SetDoubleValue("Other Settings", "LodNearDistance", Settings::lod_near_distance);
+    ini.SetDoubleValue("Other Settings", "LodFarDistance", Settings::lod_far_distance);
+    ini.SetDoubleValue("Other Settings", "LodMidStepHours", Settings::lod_mid_step);
+    ini.SetDoubleValue("Other Settings", "LodFarStepHours", Settings::lod_far_step);
+    ini.SetDoubleValue("Other Settings", "LodRetierDistance", Settings::lod_retier_distance);
 
     // LoreBox settings (defaults true, except ShowModulatorName and ShowMultiplier)
     const bool lb_title = ini.GetBoolValue("LoreBox", "ShowTitle", true);
@@ -1057,6 +1220,88 @@ void PresetParse::LoadJSONSettings() {
         Settings::max_dirty_updates.store(
             std::clamp<size_t>(value, Settings::max_dirty_updates_min, Settings::max_dirty_updates_max));
     }
+    if (doc.HasMember("dirty_update_budget_us") && doc["dirty_update_budget_us"].IsUint()) {
+        const auto value = doc["dirty_update_budget_us"].GetUint();
+        Settings::dirty_update_budget_us.store(
+            std::clamp(value, Settings::dirty_update_budget_us_min, Settings::dirty_update_budget_us_max));
+    }
+}
+
+namespace {
+    Resolution Resolve(RE::TESForm* form, const QForm qform) {
+        const auto qform_type = Settings::QFormName(qform);
+        Resolution resolution{qform, false, nullptr, nullptr};
+
+        const std::string editorid = clib_util::editorID::get_editorID(form);
+        const std::string_view name = form->GetName() ? std::string_view(form->GetName()) : std::string_view{};
+        resolution.excluded = MatchExclude(qform_type, editorid, name).value_or(false);
+        resolution.custom = MatchCustomSetting(form, qform_type);
+
+        // each addon entry belongs to one form, so no other task runs CheckIntegrity on it
+        if (const auto itType = Settings::addon_settings.find(std::string(qform_type));
+            itType != Settings::addon_settings.end()) {
+            if (const auto it = itType->second.find(form->GetFormID());
+                it != itType->second.end() && it->second.CheckIntegrity()) {
+                resolution.addon = &it->second;
+            }
+        }
+        return resolution;
+    }
+
+    // Resolves every bound form of the enabled modules on the scheduler and publishes the result as the snapshot.
+    void PrewarmResolutions() {
+        SpeedProfiler prof("PrewarmSettings");
+
+        std::vector<RE::TESForm*> forms;
+        const auto* data_handler = RE::TESDataHandler::GetSingleton();
+        std::array<bool, 256> seen{};
+        for (const auto& name : Settings::QFORMS) {
+            const auto qform = Settings::QFormFromName(name);
+            if (qform == QForm::kNone) continue;
+            for (const auto form_type : qformRules[std::to_underlying(qform)].form_types) {
+                if (form_type == RE::FormType::None || std::exchange(seen[std::to_underlying(form_type)], true)) {
+                    continue;
+                }
+                for (auto* form : data_handler->GetFormArray(form_type)) {
+                    if (form) forms.push_back(form);
+                }
+            }
+        }
+
+        constexpr size_t chunk_size = 1024;
+        std::vector<std::vector<std::pair<FormID, Resolution>>> parts((forms.size() + chunk_size - 1) / chunk_size);
+        {
+            TaskGroup group;
+            for (size_t p = 0; p < parts.size(); ++p) {
+                group.Run([&forms, &parts, p]() {
+                    const size_t end = std::min(forms.size(), (p + 1) * chunk_size);
+                    for (size_t i = p * chunk_size; i < end; ++i) {
+                        if (const auto qform = Settings::GetQForm(forms[i]); qform != QForm::kNone) {
+                            parts[p].emplace_back(forms[i]->GetFormID(), Resolve(forms[i], qform));
+                        }
+                    }
+                });
+            }
+            group.Wait();
+        }
+
+        std::vector<std::pair<FormID, Resolution>> merged;
+        for (auto& part : parts) merged.insert(merged.end(), part.begin(), part.end());
+        std::ranges::sort(merged, {}, &std::pair<FormID, Resolution>::first);
+
+        auto snapshot = std::make_unique<ResolutionSnapshot>();
+        snapshot->ids.reserve(merged.size());
+        snapshot->resolutions.reserve(merged.size());
+        for (const auto& [formid, resolution] : merged) {
+            snapshot->ids.push_back(formid);
+            snapshot->resolutions.push_back(resolution);
+        }
+        snapshot->exclude_generation = g_excludeGeneration.load(std::memory_order_acquire);
+
+        g_snapshot.store(snapshot.get(), std::memory_order_release);
+        logger::info("Prewarmed settings of {} forms", snapshot->ids.size());
+        g_snapshots.push_back(std::move(snapshot));
+    }
 }
 
 void PresetParse::LoadFormGroups() {
@@ -1069,11 +1314,12 @@ void PresetParse::LoadSettingsParallel() {
 
     {
         std::unique_lock lk(g_settingsCacheMtx);
-        g_qformCache.clear();
         g_excludeCache.clear();
         g_customCache.clear();
         g_addonCache.clear();
     }
+    // the settings it points into are about to be replaced
+    g_snapshot.store(nullptr, std::memory_order_release);
 
     try {
         LoadINISettings();
@@ -1090,10 +1336,12 @@ void PresetParse::LoadSettingsParallel() {
     for (const auto& [key,val] : Settings::INI_settings["Modules"]) {
         if (val) Settings::QFORMS.push_back(key);
     }
+    BuildQFormTable();
+
+    // parsed presets of the last start; only files that changed since then go through yaml-cpp
+    PresetCache presetCache;
 
-    std::vector<std::future<void>> typeFutures;
-    typeFutures.reserve(Settings::QFORMS.size());
-    ThreadPool typePool(numThreads);
+    TaskGroup typeGroup;
 
     std::mutex defaultsettingsMutex;
     std::mutex customsettingsMutex;
@@ -1104,11 +1352,11 @@ void PresetParse::LoadSettingsParallel() {
     LoadFormGroups();
 
     for (const auto& _qftype : Settings::QFORMS) {
-        typeFutures.push_back(typePool.enqueue(
-                [_qftype,&defaultsettingsMutex,&customsettingsMutex,&excludeListMutex,&addonsettingsMutex]() {
+        typeGroup.Run(
+                [_qftype,&presetCache,&defaultsettingsMutex,&customsettingsMutex,&excludeListMutex,&addonsettingsMutex]() {
                     try {
                         logger::info("Loading defaultsettings for {}", _qftype);
-                        if (auto temp_default_settings = parseDefaults(_qftype); !temp_default_settings.IsEmpty()) {
+                        if (auto temp_default_settings = parseDefaults(_qftype, &presetCache); !temp_default_settings.IsEmpty()) {
                             std::lock_guard lock(defaultsettingsMutex);
                             Settings::defaultsettings[_qftype] = temp_default_settings;
                         }
@@ -1119,7 +1367,7 @@ void PresetParse::LoadSettingsParallel() {
                     }
                     try {
                         logger::info("Loading custom settings for {}", _qftype);
-                        if (const auto temp_custom_settings = parseCustomsParallel(_qftype); !temp_custom_settings.
+                        if (const auto temp_custom_settings = parseCustomsParallel(_qftype, presetCache); !temp_custom_settings.
                             empty()) {
                             std::lock_guard lock(customsettingsMutex);
                             Settings::custom_settings[_qftype] = temp_custom_settings;
@@ -1131,8 +1379,10 @@ void PresetParse::LoadSettingsParallel() {
                     }
                     try {
                         logger::info("Loading exclude list for {}", _qftype);
+                        auto temp_exclude_list = LoadExcludeList(_qftype);
+                        BuildExcludeMatcher(_qftype, temp_exclude_list);
                         std::lock_guard lock(excludeListMutex);
-                        Settings::exclude_list[_qftype] = LoadExcludeList(_qftype);
+                        Settings::exclude_list[_qftype] = std::move(temp_exclude_list);
                     } catch (const std::exception& ex) {
                         logger::critical("Failed to load exclude list for {}: {}", _qftype, ex.what());
                         Settings::failed_to_load = true;
@@ -1140,19 +1390,24 @@ void PresetParse::LoadSettingsParallel() {
                     }
                     try {
                         logger::info("Loading addons for {}", _qftype);
+                        // parse outside the lock: waiting on the nested group may run another type's task here
+                        auto temp_addon_settings = parseAddOnsParallel(_qftype, presetCache);
                         std::lock_guard lock(addonsettingsMutex);
-                        Settings::addon_settings[_qftype] = parseAddOnsParallel(_qftype);
+                        Settings::addon_settings[_qftype] = std::move(temp_addon_settings);
                     } catch (const std::exception& ex) {
                         logger::critical("Failed to load addons for {}: {}", _qftype, ex.what());
                         Settings::failed_to_load = true;
                     }
                 }
-                )
             );
     }
 
-    for (auto& fut : typeFutures) {
-        fut.get();
+    typeGroup.Wait();
+    logger::info("Settings loaded on {} scheduler workers", TaskScheduler::Get().WorkerCount());
+    presetCache.Save();
+    BuildCustomMatchers();
+    if (Settings::prewarm_settings && !Settings::failed_to_load) {
+        PrewarmResolutions();
     }
 
     try {
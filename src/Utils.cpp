@@ -318,6 +318,51 @@ bool Utils::Types::FormEditorID::operator<(const FormEditorID& other) const {
     return false;
 }
 
+Utils::Types::EditorIDPool::EditorIDPool() {
+    strings_.emplace_back();
+    index_.emplace(strings_.back(), 0);
+}
+
+uint32_t Utils::Types::EditorIDPool::Intern(const std::string_view a_editorid) {
+    if (a_editorid.empty()) return 0;
+    {
+        std::shared_lock lock(mutex_);
+        if (const auto it = index_.find(a_editorid); it != index_.end()) return it->second;
+    }
+    std::unique_lock lock(mutex_);
+    if (const auto it = index_.find(a_editorid); it != index_.end()) return it->second;
+    const auto handle = static_cast<uint32_t>(strings_.size());
+    const auto& stored = strings_.emplace_back(a_editorid);
+    index_.emplace(stored, handle);
+    bytes_ += stored.capacity() + 1;
+    return handle;
+}
+
+std::string_view Utils::Types::EditorIDPool::Get(const uint32_t a_handle) const {
+    std::shared_lock lock(mutex_);
+    if (a_handle >= strings_.size()) return {};
+    return strings_[a_handle];
+}
+
+size_t Utils::Types::EditorIDPool::Size() const {
+    std::shared_lock lock(mutex_);
+    return strings_.size() - 1;
+}
+
+size_t Utils::Types::EditorIDPool::Bytes() const {
+    std::shared_lock lock(mutex_);
+    return bytes_ + strings_.size() * (sizeof(std::string) + sizeof(std::string_view) + sizeof(uint32_t));
+}
+
+uint32_t Utils::Types::InternEditorID(const RE::TESForm* form) {
+    if (!form) return 0;
+    return EditorIDPool::GetSingleton()->Intern(clib_util::editorID::get_editorID(form));
+}
+
+std::string_view Utils::Types::FormEditorIDX::GetEditorID() const {
+    return EditorIDPool::GetSingleton()->Get(editor_id);
+}
+
 bool Utils::Types::FormEditorIDX::operator==(const FormEditorIDX& other) const {
     return form_id == other.form_id;
 }
@@ -48,6 +48,7 @@ namespace {
             eventSourceHolder->AddEventSink<RE::TESSleepStopEvent>(eventSink);
             eventSourceHolder->AddEventSink<RE::TESWaitStopEvent>(eventSink);
             eventSourceHolder->AddEventSink<RE::TESFormDeleteEvent>(eventSink);
+            eventSourceHolder->AddEventSink<RE::TESMoveAttachDetachEvent>(eventSink);
             SKSE::GetCrosshairRefEventSource()->AddEventSink(eventSink);
             RE::PlayerCharacter::GetSingleton()->AsBGSActorCellEventSource()->AddEventSink(eventSink);
             logger::info("Event sinks added.");